@@ -1,4 +1,5 @@
 #pragma once
 
 #include <MetaNN/data/batch/batch.h>
+#include <MetaNN/data/batch/batch_one_hot_vector.h>
 #include <MetaNN/data/batch/batch_sequence.h>
\ No newline at end of file
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <MetaNN/data/batch/batch.h>
+#include <MetaNN/data/cardinal/matrix/one_hot_vector.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <cstring>
+#include <stdexcept>
+#include <typeindex>
+
+namespace MetaNN
+{
+template <typename TElem, typename TDevice>
+class BatchOneHotVector;
+
+namespace NSBatchOneHotVector
+{
+    template <typename TElem, typename TDevice>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+    public:
+        EvalItem(EvalHandle<BatchMatrix<TElem, TDevice>> resBuf,
+                 BatchOneHotVector<TElem, TDevice> p_data)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_data(std::move(p_data))
+        {}
+
+        EvalHandle<BatchMatrix<TElem, TDevice>> m_resHandle;
+        BatchOneHotVector<TElem, TDevice> m_data;
+    };
+
+    template <typename TElem, typename TDevice>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& data = evalItem.m_data;
+            BatchMatrix<TElem, TDevice> out(data.Shape());
+            auto lowLayer = LowerAccess(out);
+            auto mem = lowLayer.MutableRawMemory();
+
+            const size_t batchNum = data.Shape().BatchNum();
+            const size_t colNum = data.Shape().ColNum();
+            memset(mem, 0, sizeof(TElem) * batchNum * colNum);
+            for (size_t i = 0; i < batchNum; ++i)
+            {
+                mem[i * colNum + data.HotPos(i)] = 1;
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// A batch of one-hot row vectors, only the hot positions are stored.
+/// Dot with it gathers rows of the other operand instead of multiplying a dense matrix.
+template <typename TElem, typename TDevice>
+class BatchOneHotVector
+{
+public:
+    using CategoryTag = CategoryTags::BatchMatrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+public:
+    template <typename TPosCont>
+    explicit BatchOneHotVector(size_t colNum, const TPosCont& p_hotPos)
+        : m_shape(p_hotPos.size(), 1, colNum)
+        , m_hotPos(p_hotPos.size())
+    {
+        size_t* mem = m_hotPos.RawMemory();
+        for (auto pos : p_hotPos)
+        {
+            if ((size_t)pos >= colNum)
+            {
+                throw std::runtime_error("One hot vector hot position setting error.");
+            }
+            *mem++ = (size_t)pos;
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    bool operator== (const BatchOneHotVector& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_hotPos == val.m_hotPos);
+    }
+
+    size_t HotPos(size_t id) const
+    {
+        if (id >= m_shape.BatchNum())
+        {
+            throw std::runtime_error("ID out of bound.");
+        }
+        return (m_hotPos.RawMemory())[id];
+    }
+
+    auto operator [] (size_t id) const
+    {
+        return OneHotVector<ElementType, DeviceType>(m_shape.ColNum(), HotPos(id));
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSBatchOneHotVector::EvalItem<ElementType, DeviceType>;
+        using TEvalGroup = NSBatchOneHotVector::EvalGroup<ElementType, DeviceType>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<size_t, DeviceType> m_hotPos;
+    EvalBuffer<BatchMatrix<TElem, TDevice>> m_evalBuf;
+};
+
+template <typename T>
+constexpr bool IsOneHot = false;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsOneHot<OneHotVector<TElem, TDevice>> = true;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsOneHot<BatchOneHotVector<TElem, TDevice>> = true;
+}
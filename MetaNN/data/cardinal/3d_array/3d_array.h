@@ -100,6 +100,11 @@ struct LowerAccessImpl<ThreeDArray<TElem, TDevice>>
         return m_data.m_mem.RawMemory();
     }
 
+    const auto& SharedMemory() const
+    {
+        return m_data.m_mem;
+    }
+
 private:
     ThreeDArray<TElem, TDevice> m_data;
 };
@@ -1,3 +1,4 @@
 #pragma once
 
-#include <MetaNN/data/cardinal/3d_array/3d_array.h>
\ No newline at end of file
+#include <MetaNN/data/cardinal/3d_array/3d_array.h>
+#include <MetaNN/data/cardinal/3d_array/channel_last_3d_array.h>
\ No newline at end of file
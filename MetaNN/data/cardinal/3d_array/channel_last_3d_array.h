@@ -0,0 +1,307 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/3d_array/3d_array.h>
+#include <MetaNN/data/linear_table/static_array.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <algorithm>
+#include <cassert>
+#include <typeindex>
+
+namespace MetaNN
+{
+template <typename TElem, typename TDevice, typename TCategory>
+class ChannelLastArray;
+
+namespace NSChannelLast
+{
+    constexpr size_t BlockSize = 16;
+
+    // Converts one sample from [page][pixel] to [pixel][page]. The copy goes through
+    // BlockSize x BlockSize tiles so that both sides are touched a cache line at a time.
+    template <typename TElem>
+    void ToChannelLast(const TElem* in, TElem* out, size_t pageNum, size_t pixelNum)
+    {
+        for (size_t pb = 0; pb < pageNum; pb += BlockSize)
+        {
+            const size_t pe = std::min(pageNum, pb + BlockSize);
+            for (size_t xb = 0; xb < pixelNum; xb += BlockSize)
+            {
+                const size_t xe = std::min(pixelNum, xb + BlockSize);
+                for (size_t x = xb; x < xe; ++x)
+                {
+                    for (size_t p = pb; p < pe; ++p)
+                    {
+                        out[x * pageNum + p] = in[p * pixelNum + x];
+                    }
+                }
+            }
+        }
+    }
+
+    // Converts one sample from [pixel][page] back to [page][pixel].
+    template <typename TElem>
+    void ToPageMajor(const TElem* in, TElem* out, size_t pageNum, size_t pixelNum)
+    {
+        for (size_t pb = 0; pb < pageNum; pb += BlockSize)
+        {
+            const size_t pe = std::min(pageNum, pb + BlockSize);
+            for (size_t xb = 0; xb < pixelNum; xb += BlockSize)
+            {
+                const size_t xe = std::min(pixelNum, xb + BlockSize);
+                for (size_t p = pb; p < pe; ++p)
+                {
+                    for (size_t x = xb; x < xe; ++x)
+                    {
+                        out[p * pixelNum + x] = in[x * pageNum + p];
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename TElem, typename TDevice, typename TCategory>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+        using PrincipalType = PrincipalDataType<TCategory, TElem, TDevice>;
+    public:
+        EvalItem(EvalHandle<PrincipalType> resBuf,
+                 ChannelLastArray<TElem, TDevice, TCategory> p_data)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_data(std::move(p_data))
+        {}
+
+        EvalHandle<PrincipalType> m_resHandle;
+        ChannelLastArray<TElem, TDevice, TCategory> m_data;
+    };
+
+    template <typename TElem, typename TDevice, typename TCategory>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice, TCategory>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice, TCategory>;
+        using PrincipalType = PrincipalDataType<TCategory, TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& data = evalItem.m_data;
+            PrincipalType out(data.Shape());
+            auto lowOut = LowerAccess(out);
+            TElem* mem_out = lowOut.MutableRawMemory();
+
+            auto lowData = LowerAccess(data);
+            const TElem* mem_in = lowData.RawMemory();
+
+            const auto& cardinal = data.Shape().CardinalShape();
+            const size_t pageNum = cardinal.PageNum();
+            const size_t pixelNum = cardinal.RowNum() * cardinal.ColNum();
+            const size_t sampleSize = cardinal.Count();
+            for (size_t pos = 0; pos < data.Shape().Count(); pos += sampleSize)
+            {
+                ToPageMajor(mem_in + pos, mem_out + pos, pageNum, pixelNum);
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// 3D array (or batch of them) stored channel-last: the pages of a (row, col) position
+/// are contiguous, i.e. element (page, row, col) lives at (row * colNum + col) * pageNum + page.
+/// Conv2D, MaxPool and AvgPool read it in place, with their inner loops over contiguous
+/// channels. Constructing it from the principal type converts the layout,
+/// evaluating it gives the page-major principal type back.
+template <typename TElem, typename TDevice, typename TCategory>
+class ChannelLastArray
+{
+    static_assert(std::is_same_v<RemConstRef<TElem>, TElem>,
+                  "TElem is not an available type");
+    static_assert(std::is_same_v<TCategory, CategoryTags::ThreeDArray> ||
+                  std::is_same_v<TCategory, CategoryTags::BatchThreeDArray>,
+                  "Only 3D arrays and batches of them support channel-last layout.");
+public:
+    using CategoryTag = TCategory;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+    using PrincipalType = PrincipalDataType<TCategory, TElem, TDevice>;
+
+    friend struct LowerAccessImpl<ChannelLastArray>;
+
+public:
+    explicit ChannelLastArray(MetaNN::Shape<CategoryTag> p_shape = MetaNN::Shape<CategoryTag>())
+        : m_shape(std::move(p_shape))
+        , m_mem(m_shape.Count())
+    {}
+
+    template <typename...TShapeParams>
+    explicit ChannelLastArray(size_t val, TShapeParams&&... shapeParams)
+        : m_shape(val, std::forward<TShapeParams>(shapeParams)...)
+        , m_mem(m_shape.Count())
+    {}
+
+    template <typename...TShapeParams>
+    explicit ChannelLastArray(ContinuousMemory<ElementType, DeviceType> p_mem,
+                              TShapeParams&&... shapeParams)
+        : m_shape(std::forward<TShapeParams>(shapeParams)...)
+        , m_mem(std::move(p_mem))
+    {}
+
+    explicit ChannelLastArray(const PrincipalType& p_ori)
+        : m_shape(p_ori.Shape())
+        , m_mem(m_shape.Count())
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        const TElem* mem_in = LowerAccess(p_ori).RawMemory();
+        TElem* mem_out = m_mem.RawMemory();
+
+        const auto& cardinal = m_shape.CardinalShape();
+        const size_t pixelNum = cardinal.RowNum() * cardinal.ColNum();
+        for (size_t pos = 0; pos < m_shape.Count(); pos += cardinal.Count())
+        {
+            NSChannelLast::ToChannelLast(mem_in + pos, mem_out + pos, cardinal.PageNum(), pixelNum);
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    bool operator== (const ChannelLastArray& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_mem == val.m_mem);
+    }
+
+    bool AvailableForWrite() const
+    {
+        return m_mem.IsShared();
+    }
+
+    /// Indices are given in the same order as the principal type: ([batch,] page, row, col).
+    void SetValue(size_t p_pageId, size_t p_rowId, size_t p_colId, ElementType val)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+        assert(AvailableForWrite());
+        (m_mem.RawMemory())[Pos(p_pageId, p_rowId, p_colId)] = val;
+    }
+
+    void SetValue(size_t p_batchId, size_t p_pageId, size_t p_rowId, size_t p_colId, ElementType val)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+        assert(AvailableForWrite());
+        (m_mem.RawMemory())[Pos(p_batchId, p_pageId, p_rowId, p_colId)] = val;
+    }
+
+    const auto operator () (size_t p_pageId, size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+        return (m_mem.RawMemory())[Pos(p_pageId, p_rowId, p_colId)];
+    }
+
+    const auto operator () (size_t p_batchId, size_t p_pageId, size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+        return (m_mem.RawMemory())[Pos(p_batchId, p_pageId, p_rowId, p_colId)];
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSChannelLast::EvalItem<ElementType, DeviceType, CategoryTag>;
+        using TEvalGroup = NSChannelLast::EvalGroup<ElementType, DeviceType, CategoryTag>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    size_t Pos(size_t p_pageId, size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<CategoryTag, CategoryTags::ThreeDArray>);
+        return CardinalPos(m_shape, p_pageId, p_rowId, p_colId);
+    }
+
+    size_t Pos(size_t p_batchId, size_t p_pageId, size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<CategoryTag, CategoryTags::BatchThreeDArray>);
+        if (p_batchId >= m_shape.BatchNum())
+        {
+            throw std::runtime_error("Invalid index for ChannelLastArray");
+        }
+        const auto& cardinal = m_shape.Cardinal();
+        return p_batchId * cardinal.Count() + CardinalPos(cardinal, p_pageId, p_rowId, p_colId);
+    }
+
+    static size_t CardinalPos(const MetaNN::Shape<CategoryTags::ThreeDArray>& shape,
+                              size_t p_pageId, size_t p_rowId, size_t p_colId)
+    {
+        if ((p_pageId >= shape.PageNum()) || (p_rowId >= shape.RowNum()) || (p_colId >= shape.ColNum()))
+        {
+            throw std::runtime_error("Invalid index for ChannelLastArray");
+        }
+        return (p_rowId * shape.ColNum() + p_colId) * shape.PageNum() + p_pageId;
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<ElementType, DeviceType> m_mem;
+    EvalBuffer<PrincipalType> m_evalBuf;
+};
+
+template <typename TElem, typename TDevice>
+using ChannelLastThreeDArray = ChannelLastArray<TElem, TDevice, CategoryTags::ThreeDArray>;
+
+template <typename TElem, typename TDevice>
+using BatchChannelLastThreeDArray = ChannelLastArray<TElem, TDevice, CategoryTags::BatchThreeDArray>;
+
+template <typename TElem, typename TDevice, typename TCategory>
+struct LowerAccessImpl<ChannelLastArray<TElem, TDevice, TCategory>>
+{
+    LowerAccessImpl(ChannelLastArray<TElem, TDevice, TCategory> p)
+        : m_data(std::move(p))
+    {}
+
+    auto MutableRawMemory()
+    {
+        return m_data.m_mem.RawMemory();
+    }
+
+    const auto RawMemory() const
+    {
+        return m_data.m_mem.RawMemory();
+    }
+
+    const auto& SharedMemory() const
+    {
+        return m_data.m_mem;
+    }
+
+private:
+    ChannelLastArray<TElem, TDevice, TCategory> m_data;
+};
+
+template <typename T>
+constexpr bool IsChannelLast = false;
+
+template <typename TElem, typename TDevice, typename TCategory>
+constexpr bool IsChannelLast<ChannelLastArray<TElem, TDevice, TCategory>> = true;
+}
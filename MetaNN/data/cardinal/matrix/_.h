@@ -2,6 +2,11 @@
 
 // matrices
 #include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/data/cardinal/matrix/csr_matrix.h>
+#include <MetaNN/data/cardinal/matrix/fixed_matrix.h>
+#include <MetaNN/data/cardinal/matrix/matrix_view.h>
+#include <MetaNN/data/cardinal/matrix/packed_matrix.h>
+#include <MetaNN/data/cardinal/matrix/quantized_matrix.h>
 #include <MetaNN/data/cardinal/matrix/trival_matrix.h>
 
 
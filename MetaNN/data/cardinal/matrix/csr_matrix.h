@@ -0,0 +1,248 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+#include <typeindex>
+#include <vector>
+
+namespace MetaNN
+{
+template<typename TElem, typename TDevice>
+class CsrMatrix;
+
+namespace NSCsrMatrix
+{
+    template <typename TElem, typename TDevice>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+    public:
+        EvalItem(EvalHandle<Matrix<TElem, TDevice>> resBuf,
+                 CsrMatrix<TElem, TDevice> p_data)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_data(std::move(p_data))
+        {}
+
+        EvalHandle<Matrix<TElem, TDevice>> m_resHandle;
+        CsrMatrix<TElem, TDevice> m_data;
+    };
+
+    template <typename TElem, typename TDevice>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& data = evalItem.m_data;
+            Matrix<TElem, TDevice> out(data.Shape());
+            auto lowLayer = LowerAccess(out);
+            TElem* mem_out = lowLayer.MutableRawMemory();
+
+            const size_t rowNum = data.Shape().RowNum();
+            const size_t colNum = data.Shape().ColNum();
+            std::fill(mem_out, mem_out + rowNum * colNum, TElem{});
+
+            auto lowData = LowerAccess(data);
+            const size_t* rowPtr = lowData.RowPtr();
+            const size_t* colIdx = lowData.ColIdx();
+            const TElem* value = lowData.RawMemory();
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                for (size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                {
+                    mem_out[colIdx[p]] = value[p];
+                }
+                mem_out += colNum;
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// Sparse matrix in compressed sparse row format: the non-zero elements of row i are
+/// value[p] at column colIdx[p], for p in [rowPtr[i], rowPtr[i + 1]).
+/// Evaluating it gives the dense matrix; Dot consumes the sparse form directly.
+template<typename TElem, typename TDevice>
+class CsrMatrix
+{
+    static_assert(std::is_same<RemConstRef<TElem>, TElem>::value,
+                  "TElem is not an available type");
+public:
+    using CategoryTag = CategoryTags::Matrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+    friend struct LowerAccessImpl<CsrMatrix>;
+
+public:
+    explicit CsrMatrix(size_t p_rowNum = 0, size_t p_colNum = 0)
+        : CsrMatrix(p_rowNum, p_colNum, std::vector<std::tuple<size_t, size_t, TElem>>{})
+    {}
+
+    /// Build from (row, col, value) triples in any order, values of duplicated positions are summed.
+    template <typename TTripleCont>
+    CsrMatrix(size_t p_rowNum, size_t p_colNum, const TTripleCont& p_triples)
+        : m_shape(p_rowNum, p_colNum)
+        , m_rowPtr(p_rowNum + 1)
+        , m_nonZeroNum(0)
+        , m_colIdx(0)
+        , m_value(0)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        std::vector<std::tuple<size_t, size_t, TElem>> triples;
+        for (const auto& [row, col, val] : p_triples)
+        {
+            if ((row >= p_rowNum) || (col >= p_colNum))
+            {
+                throw std::runtime_error("Invalid index for CsrMatrix");
+            }
+            triples.emplace_back((size_t)row, (size_t)col, (TElem)val);
+        }
+        std::stable_sort(triples.begin(), triples.end(),
+                         [](const auto& a, const auto& b)
+                         {
+                             return std::tie(std::get<0>(a), std::get<1>(a)) <
+                                    std::tie(std::get<0>(b), std::get<1>(b));
+                         });
+
+        std::vector<std::tuple<size_t, size_t, TElem>> merged;
+        for (const auto& item : triples)
+        {
+            if (!merged.empty() &&
+                (std::get<0>(merged.back()) == std::get<0>(item)) &&
+                (std::get<1>(merged.back()) == std::get<1>(item)))
+            {
+                std::get<2>(merged.back()) += std::get<2>(item);
+            }
+            else
+            {
+                merged.push_back(item);
+            }
+        }
+
+        m_nonZeroNum = merged.size();
+        m_colIdx = ContinuousMemory<size_t, DeviceType>(m_nonZeroNum);
+        m_value = ContinuousMemory<ElementType, DeviceType>(m_nonZeroNum);
+
+        size_t* rowPtr = m_rowPtr.RawMemory();
+        std::fill(rowPtr, rowPtr + p_rowNum + 1, (size_t)0);
+        for (size_t p = 0; p < m_nonZeroNum; ++p)
+        {
+            ++rowPtr[std::get<0>(merged[p]) + 1];
+            (m_colIdx.RawMemory())[p] = std::get<1>(merged[p]);
+            (m_value.RawMemory())[p] = std::get<2>(merged[p]);
+        }
+        for (size_t i = 0; i < p_rowNum; ++i)
+        {
+            rowPtr[i + 1] += rowPtr[i];
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    size_t NonZeroNum() const noexcept
+    {
+        return m_nonZeroNum;
+    }
+
+    bool operator== (const CsrMatrix& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_rowPtr == val.m_rowPtr) &&
+               (m_colIdx == val.m_colIdx) &&
+               (m_value == val.m_value);
+    }
+
+    auto operator () (size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        if ((p_rowId >= m_shape.RowNum()) || (p_colId >= m_shape.ColNum()))
+        {
+            throw std::runtime_error("Invalid index for CsrMatrix");
+        }
+        const size_t* colBeg = m_colIdx.RawMemory() + (m_rowPtr.RawMemory())[p_rowId];
+        const size_t* colEnd = m_colIdx.RawMemory() + (m_rowPtr.RawMemory())[p_rowId + 1];
+        const size_t* pos = std::lower_bound(colBeg, colEnd, p_colId);
+        if ((pos == colEnd) || (*pos != p_colId))
+        {
+            return ElementType{};
+        }
+        return (m_value.RawMemory())[pos - m_colIdx.RawMemory()];
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSCsrMatrix::EvalItem<ElementType, DeviceType>;
+        using TEvalGroup = NSCsrMatrix::EvalGroup<ElementType, DeviceType>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<size_t, DeviceType> m_rowPtr;
+    size_t m_nonZeroNum;
+    ContinuousMemory<size_t, DeviceType> m_colIdx;
+    ContinuousMemory<ElementType, DeviceType> m_value;
+    EvalBuffer<Matrix<ElementType, DeviceType>> m_evalBuf;
+};
+
+template<typename TElem, typename TDevice>
+struct LowerAccessImpl<CsrMatrix<TElem, TDevice>>
+{
+    LowerAccessImpl(CsrMatrix<TElem, TDevice> p)
+        : m_data(std::move(p))
+    {}
+
+    const size_t* RowPtr() const
+    {
+        return m_data.m_rowPtr.RawMemory();
+    }
+
+    const size_t* ColIdx() const
+    {
+        return m_data.m_colIdx.RawMemory();
+    }
+
+    const TElem* RawMemory() const
+    {
+        return m_data.m_value.RawMemory();
+    }
+
+private:
+    CsrMatrix<TElem, TDevice> m_data;
+};
+
+template <typename T>
+constexpr bool IsCsrMatrix = false;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsCsrMatrix<CsrMatrix<TElem, TDevice>> = true;
+}
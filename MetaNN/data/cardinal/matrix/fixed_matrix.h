@@ -0,0 +1,131 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/data/facilities/continuous_memory.h>
+#include <MetaNN/data/facilities/lower_access.h>
+#include <MetaNN/data/facilities/shape.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/data/facilities/tags.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <cassert>
+#include <stdexcept>
+
+namespace MetaNN
+{
+/// Matrix whose row and column numbers are template parameters.
+/// It behaves as a Matrix for every operator (evaluating it shares the memory with a Matrix),
+/// and operators whose operands are all fixed-shape select kernels with compile-time loop bounds.
+template<typename TElem, typename TDevice, size_t RowNum, size_t ColNum>
+class FixedMatrix
+{
+    static_assert(std::is_same<RemConstRef<TElem>, TElem>::value,
+                  "TElem is not an available type");
+    static_assert((RowNum > 0) && (ColNum > 0), "FixedMatrix cannot be empty");
+public:
+    using CategoryTag = CategoryTags::Matrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+    constexpr static size_t FixedRowNum = RowNum;
+    constexpr static size_t FixedColNum = ColNum;
+
+    friend struct LowerAccessImpl<FixedMatrix>;
+
+public:
+    FixedMatrix()
+        : m_shape(RowNum, ColNum)
+        , m_mem(RowNum * ColNum)
+    {}
+
+    explicit FixedMatrix(ContinuousMemory<ElementType, DeviceType> p_mem)
+        : m_shape(RowNum, ColNum)
+        , m_mem(std::move(p_mem))
+    {}
+
+    /// Share the memory of a matrix with identical shape.
+    explicit FixedMatrix(const Matrix<ElementType, DeviceType>& p_matrix)
+        : m_shape(RowNum, ColNum)
+        , m_mem(LowerAccess(p_matrix).SharedMemory())
+    {
+        if (p_matrix.Shape() != m_shape)
+        {
+            throw std::runtime_error("Shape mismatch for FixedMatrix.");
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    bool operator== (const FixedMatrix& val) const
+    {
+        return m_mem == val.m_mem;
+    }
+
+    bool AvailableForWrite() const
+    {
+        return m_mem.IsShared();
+    }
+
+    void SetValue(size_t p_rowId, size_t p_colId, ElementType val)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        assert(AvailableForWrite());
+        assert((p_rowId < RowNum) && (p_colId < ColNum));
+        (m_mem.RawMemory())[p_rowId * ColNum + p_colId] = val;
+    }
+
+    const auto operator () (size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        assert((p_rowId < RowNum) && (p_colId < ColNum));
+        return (m_mem.RawMemory())[p_rowId * ColNum + p_colId];
+    }
+
+    auto EvalRegister() const
+    {
+        return MakeConstEvalHandle(Matrix<ElementType, DeviceType>(m_mem, m_shape));
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<ElementType, DeviceType> m_mem;
+};
+
+template<typename TElem, typename TDevice, size_t RowNum, size_t ColNum>
+struct LowerAccessImpl<FixedMatrix<TElem, TDevice, RowNum, ColNum>>
+{
+    LowerAccessImpl(FixedMatrix<TElem, TDevice, RowNum, ColNum> p)
+        : m_matrix(std::move(p))
+    {}
+
+    TElem* MutableRawMemory()
+    {
+        return m_matrix.m_mem.RawMemory();
+    }
+
+    const TElem* RawMemory() const
+    {
+        return m_matrix.m_mem.RawMemory();
+    }
+
+    const auto& SharedMemory() const
+    {
+        return m_matrix.m_mem;
+    }
+
+private:
+    FixedMatrix<TElem, TDevice, RowNum, ColNum> m_matrix;
+};
+
+template <typename T>
+constexpr bool IsFixedMatrix = false;
+
+template <typename TElem, typename TDevice, size_t RowNum, size_t ColNum>
+constexpr bool IsFixedMatrix<FixedMatrix<TElem, TDevice, RowNum, ColNum>> = true;
+}
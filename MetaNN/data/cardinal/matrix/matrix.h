@@ -9,6 +9,9 @@
 
 namespace MetaNN
 {
+template<typename TElem, typename TDevice>
+class MatrixView;
+
 template<typename TElem, typename TDevice>
 class Matrix
 {
@@ -20,6 +23,7 @@ public:
     using DeviceType = TDevice;
     
     friend struct LowerAccessImpl<Matrix>;
+    friend class MatrixView<TElem, TDevice>;
 
 public:
     explicit Matrix(MetaNN::Shape<CategoryTag> p_shape = MetaNN::Shape<CategoryTag>())
@@ -101,6 +105,11 @@ struct LowerAccessImpl<Matrix<TElem, TDevice>>
         return m_matrix.m_mem.RawMemory();
     }
 
+    const auto& SharedMemory() const
+    {
+        return m_matrix.m_mem;
+    }
+
 private:
     Matrix<TElem, TDevice> m_matrix;
 };
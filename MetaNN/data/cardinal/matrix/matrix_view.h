@@ -0,0 +1,250 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <cstring>
+#include <stdexcept>
+#include <typeindex>
+
+namespace MetaNN
+{
+namespace NSMatrixView
+{
+    template <typename TElem, typename TDevice>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+    public:
+        EvalItem(EvalHandle<Matrix<TElem, TDevice>> resBuf,
+                 MatrixView<TElem, TDevice> p_view)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_view(std::move(p_view))
+        {}
+
+        EvalHandle<Matrix<TElem, TDevice>> m_resHandle;
+        MatrixView<TElem, TDevice> m_view;
+    };
+
+    template <typename TElem, typename TDevice>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& view = evalItem.m_view;
+            Matrix<TElem, TDevice> out(view.Shape());
+            auto lowLayer = LowerAccess(out);
+            TElem* mem_out = lowLayer.MutableRawMemory();
+
+            auto lowView = LowerAccess(view);
+            const TElem* mem_in = lowView.RawMemory();
+
+            const size_t rowNum = view.Shape().RowNum();
+            const size_t colNum = view.Shape().ColNum();
+            const size_t rowLen = view.RowLen();
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                memcpy(mem_out, mem_in, sizeof(TElem) * colNum);
+                mem_out += colNum;
+                mem_in += rowLen;
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// A block of an existing matrix: shares the memory of the original matrix and
+/// locates element (i, j) at i * RowLen() + j. No data is copied at construction.
+template<typename TElem, typename TDevice>
+class MatrixView
+{
+    static_assert(std::is_same<RemConstRef<TElem>, TElem>::value,
+                  "TElem is not an available type");
+public:
+    using CategoryTag = CategoryTags::Matrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+    friend struct LowerAccessImpl<MatrixView>;
+
+public:
+    explicit MatrixView(const Matrix<TElem, TDevice>& p_ori,
+                        size_t p_rowBegin, size_t p_rowEnd,
+                        size_t p_colBegin, size_t p_colEnd)
+        : MatrixView(p_ori.m_mem, p_ori.Shape().RowNum(), p_ori.Shape().ColNum(), p_ori.Shape().ColNum(),
+                     p_rowBegin, p_rowEnd, p_colBegin, p_colEnd)
+    {}
+
+    explicit MatrixView(const MatrixView& p_ori,
+                        size_t p_rowBegin, size_t p_rowEnd,
+                        size_t p_colBegin, size_t p_colEnd)
+        : MatrixView(p_ori.m_mem, p_ori.Shape().RowNum(), p_ori.Shape().ColNum(), p_ori.RowLen(),
+                     p_rowBegin, p_rowEnd, p_colBegin, p_colEnd)
+    {}
+
+    MatrixView(const MatrixView&) = default;
+    MatrixView(MatrixView&&) = default;
+    MatrixView& operator= (const MatrixView&) = default;
+    MatrixView& operator= (MatrixView&&) = default;
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    size_t RowLen() const noexcept
+    {
+        return m_rowLen;
+    }
+
+    bool IsContinuous() const noexcept
+    {
+        return (m_shape.RowNum() <= 1) || (m_shape.ColNum() == m_rowLen);
+    }
+
+    bool operator== (const MatrixView& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_rowLen == val.m_rowLen) &&
+               (m_mem == val.m_mem);
+    }
+
+    const auto operator () (size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        if ((p_rowId >= m_shape.RowNum()) || (p_colId >= m_shape.ColNum()))
+        {
+            throw std::runtime_error("Invalid index for MatrixView");
+        }
+        return (m_mem.RawMemory())[p_rowId * m_rowLen + p_colId];
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSMatrixView::EvalItem<ElementType, DeviceType>;
+        using TEvalGroup = NSMatrixView::EvalGroup<ElementType, DeviceType>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (IsContinuous())
+            {
+                // rows are adjacent in memory: expose them as a matrix directly.
+                evalHandle.SetData(Matrix<ElementType, DeviceType>(m_mem, m_shape));
+            }
+            else if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    MatrixView(const ContinuousMemory<ElementType, DeviceType>& p_mem,
+               size_t p_oriRowNum, size_t p_oriColNum, size_t p_oriRowLen,
+               size_t p_rowBegin, size_t p_rowEnd,
+               size_t p_colBegin, size_t p_colEnd)
+        : m_shape(CheckedShape(p_oriRowNum, p_oriColNum, p_rowBegin, p_rowEnd, p_colBegin, p_colEnd))
+        , m_rowLen(p_oriRowLen)
+        , m_mem(p_mem.Shift(p_rowBegin * p_oriRowLen + p_colBegin))
+    {}
+
+    // runs before the buffer is shifted: an invalid range never reaches the memory.
+    static MetaNN::Shape<CategoryTag> CheckedShape(size_t p_oriRowNum, size_t p_oriColNum,
+                                                   size_t p_rowBegin, size_t p_rowEnd,
+                                                   size_t p_colBegin, size_t p_colEnd)
+    {
+        if ((p_rowBegin > p_rowEnd) || (p_rowEnd > p_oriRowNum) ||
+            (p_colBegin > p_colEnd) || (p_colEnd > p_oriColNum))
+        {
+            throw std::runtime_error("MatrixView range out of bound.");
+        }
+        return MetaNN::Shape<CategoryTag>(p_rowEnd - p_rowBegin, p_colEnd - p_colBegin);
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    size_t m_rowLen;
+    ContinuousMemory<ElementType, DeviceType> m_mem;
+    EvalBuffer<Matrix<ElementType, DeviceType>> m_evalBuf;
+};
+
+template<typename TElem, typename TDevice>
+struct LowerAccessImpl<MatrixView<TElem, TDevice>>
+{
+    LowerAccessImpl(MatrixView<TElem, TDevice> p)
+        : m_view(std::move(p))
+    {}
+
+    const TElem* RawMemory() const
+    {
+        return m_view.m_mem.RawMemory();
+    }
+
+    size_t RowLen() const
+    {
+        return m_view.RowLen();
+    }
+
+private:
+    MatrixView<TElem, TDevice> m_view;
+};
+
+template <typename T>
+constexpr bool IsMatrixView = false;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsMatrixView<MatrixView<TElem, TDevice>> = true;
+
+template <typename TElem, typename TDevice>
+auto RowRange(const Matrix<TElem, TDevice>& p_ori, size_t p_rowBegin, size_t p_rowEnd)
+{
+    return MatrixView<TElem, TDevice>(p_ori, p_rowBegin, p_rowEnd, 0, p_ori.Shape().ColNum());
+}
+
+template <typename TElem, typename TDevice>
+auto ColRange(const Matrix<TElem, TDevice>& p_ori, size_t p_colBegin, size_t p_colEnd)
+{
+    return MatrixView<TElem, TDevice>(p_ori, 0, p_ori.Shape().RowNum(), p_colBegin, p_colEnd);
+}
+
+/// Helpers for kernels that accept strided operands: a view is consumed as is,
+/// other data are registered as usual and read with their natural row length.
+template <typename TData>
+auto StridedEvalRegister(const TData& data)
+{
+    if constexpr (IsMatrixView<TData>)
+    {
+        return MakeConstEvalHandle(data);
+    }
+    else
+    {
+        return data.EvalRegister();
+    }
+}
+
+template <typename TData>
+size_t RowStride(const TData& data)
+{
+    if constexpr (IsMatrixView<TData>)
+    {
+        return data.RowLen();
+    }
+    else
+    {
+        return data.Shape().ColNum();
+    }
+}
+}
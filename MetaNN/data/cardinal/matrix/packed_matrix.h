@@ -0,0 +1,198 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/blas/facilities/gemm.h>
+#include <algorithm>
+#include <stdexcept>
+#include <typeindex>
+
+namespace MetaNN
+{
+template<typename TElem, typename TDevice>
+class PackedMatrix;
+
+namespace NSPackedMatrix
+{
+    template <typename TElem, typename TDevice>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+    public:
+        EvalItem(EvalHandle<Matrix<TElem, TDevice>> resBuf,
+                 PackedMatrix<TElem, TDevice> p_data)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_data(std::move(p_data))
+        {}
+
+        EvalHandle<Matrix<TElem, TDevice>> m_resHandle;
+        PackedMatrix<TElem, TDevice> m_data;
+    };
+
+    template <typename TElem, typename TDevice>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& data = evalItem.m_data;
+            Matrix<TElem, TDevice> out(data.Shape());
+            auto lowLayer = LowerAccess(out);
+            TElem* mem_out = lowLayer.MutableRawMemory();
+
+            auto lowData = LowerAccess(data);
+            const TElem* mem_in = lowData.RawMemory();
+
+            constexpr size_t nr = PackedMatrix<TElem, TDevice>::PanelWidth;
+            const size_t rowNum = data.Shape().RowNum();
+            const size_t colNum = data.Shape().ColNum();
+            for (size_t p = 0; p < colNum; p += nr)
+            {
+                const size_t width = std::min(nr, colNum - p);
+                for (size_t i = 0; i < rowNum; ++i)
+                {
+                    std::copy(mem_in + i * nr, mem_in + i * nr + width, mem_out + i * colNum + p);
+                }
+                mem_in += rowNum * nr;
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// Matrix stored as column panels for the right operand of Dot: panel p holds columns
+/// [p * PanelWidth, (p + 1) * PanelWidth) row after row, the last panel is zero padded.
+/// This is the B panel layout of NSGemm, so Dot feeds the panels to the GEMM micro-kernel
+/// without packing the weight again. Evaluating it gives the row-major matrix.
+template<typename TElem, typename TDevice>
+class PackedMatrix
+{
+    static_assert(std::is_same<RemConstRef<TElem>, TElem>::value,
+                  "TElem is not an available type");
+public:
+    using CategoryTag = CategoryTags::Matrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+    constexpr static size_t PanelWidth = NSGemm::PanelWidth<TElem>;
+
+    friend struct LowerAccessImpl<PackedMatrix>;
+
+public:
+    explicit PackedMatrix(MetaNN::Shape<CategoryTag> p_shape = MetaNN::Shape<CategoryTag>())
+        : m_shape(std::move(p_shape))
+        , m_mem(PanelNum() * PanelWidth * m_shape.RowNum())
+    {
+        std::fill(m_mem.RawMemory(), m_mem.RawMemory() + PanelNum() * PanelWidth * m_shape.RowNum(), ElementType{});
+    }
+
+    explicit PackedMatrix(size_t p_rowNum, size_t p_colNum)
+        : PackedMatrix(MetaNN::Shape<CategoryTag>(p_rowNum, p_colNum))
+    {}
+
+    explicit PackedMatrix(const Matrix<TElem, TDevice>& p_ori)
+        : m_shape(p_ori.Shape())
+        , m_mem(PanelNum() * PanelWidth * m_shape.RowNum())
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        const size_t rowNum = m_shape.RowNum();
+        const size_t colNum = m_shape.ColNum();
+        const TElem* mem_in = LowerAccess(p_ori).RawMemory();
+        TElem* mem_out = m_mem.RawMemory();
+        for (size_t p = 0; p < colNum; p += PanelWidth)
+        {
+            const size_t width = std::min(PanelWidth, colNum - p);
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                std::copy(mem_in + i * colNum + p, mem_in + i * colNum + p + width, mem_out);
+                std::fill(mem_out + width, mem_out + PanelWidth, ElementType{});
+                mem_out += PanelWidth;
+            }
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    size_t PanelNum() const noexcept
+    {
+        return (m_shape.ColNum() + PanelWidth - 1) / PanelWidth;
+    }
+
+    bool operator== (const PackedMatrix& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_mem == val.m_mem);
+    }
+
+    auto operator () (size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        if ((p_rowId >= m_shape.RowNum()) || (p_colId >= m_shape.ColNum()))
+        {
+            throw std::runtime_error("Invalid index for PackedMatrix");
+        }
+        const size_t panel = p_colId / PanelWidth;
+        const size_t pos = (panel * m_shape.RowNum() + p_rowId) * PanelWidth + p_colId % PanelWidth;
+        return (m_mem.RawMemory())[pos];
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSPackedMatrix::EvalItem<ElementType, DeviceType>;
+        using TEvalGroup = NSPackedMatrix::EvalGroup<ElementType, DeviceType>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<ElementType, DeviceType> m_mem;
+    EvalBuffer<Matrix<ElementType, DeviceType>> m_evalBuf;
+};
+
+template<typename TElem, typename TDevice>
+struct LowerAccessImpl<PackedMatrix<TElem, TDevice>>
+{
+    LowerAccessImpl(PackedMatrix<TElem, TDevice> p)
+        : m_data(std::move(p))
+    {}
+
+    const TElem* RawMemory() const
+    {
+        return m_data.m_mem.RawMemory();
+    }
+
+private:
+    PackedMatrix<TElem, TDevice> m_data;
+};
+
+template <typename T>
+constexpr bool IsPackedMatrix = false;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsPackedMatrix<PackedMatrix<TElem, TDevice>> = true;
+}
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix.h>
+#include <MetaNN/evaluate/eval_buffer.h>
+#include <MetaNN/evaluate/eval_handle.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <typeindex>
+#include <vector>
+
+namespace MetaNN
+{
+template<typename TElem, typename TDevice>
+class QuantizedMatrix;
+
+namespace NSQuantizedMatrix
+{
+    template <typename TElem, typename TDevice>
+    class EvalItem : public BaseEvalItem<TDevice>
+    {
+    public:
+        EvalItem(EvalHandle<Matrix<TElem, TDevice>> resBuf,
+                 QuantizedMatrix<TElem, TDevice> p_data)
+            : BaseEvalItem<TDevice>(std::type_index(typeid(EvalItem)),
+                                    {}, resBuf.DataPtr())
+            , m_resHandle(std::move(resBuf))
+            , m_data(std::move(p_data))
+        {}
+
+        EvalHandle<Matrix<TElem, TDevice>> m_resHandle;
+        QuantizedMatrix<TElem, TDevice> m_data;
+    };
+
+    template <typename TElem, typename TDevice>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TElem, TDevice>>
+    {
+        using EvalItemType = EvalItem<TElem, TDevice>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
+                          "Currently only CPU is supported.");
+
+            const auto& data = evalItem.m_data;
+            Matrix<TElem, TDevice> out(data.Shape());
+            auto lowLayer = LowerAccess(out);
+            TElem* mem_out = lowLayer.MutableRawMemory();
+
+            auto lowData = LowerAccess(data);
+            const int8_t* mem_in = lowData.RawMemory();
+
+            const size_t rowNum = data.Shape().RowNum();
+            const size_t colNum = data.Shape().ColNum();
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                for (size_t j = 0; j < colNum; ++j)
+                {
+                    mem_out[j] = static_cast<TElem>(lowData.ColScale(j) * mem_in[j]);
+                }
+                mem_out += colNum;
+                mem_in += colNum;
+            }
+            evalItem.m_resHandle.SetData(std::move(out));
+        }
+    };
+}
+
+/// Matrix stored as int8 with a float scale per column (or one scale for the whole
+/// matrix): element (i, j) represents ColScale(j) * q(i, j). As the right operand of
+/// Dot(x, W) a column is an output channel, so every output gets its own scale.
+/// Evaluating it gives the dequantized matrix; Dot consumes the int8 values directly.
+template<typename TElem, typename TDevice>
+class QuantizedMatrix
+{
+    static_assert(std::is_same<RemConstRef<TElem>, TElem>::value,
+                  "TElem is not an available type");
+public:
+    using CategoryTag = CategoryTags::Matrix;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+
+    friend struct LowerAccessImpl<QuantizedMatrix>;
+
+public:
+    explicit QuantizedMatrix(MetaNN::Shape<CategoryTag> p_shape = MetaNN::Shape<CategoryTag>(),
+                             bool p_perColumn = true)
+        : m_shape(std::move(p_shape))
+        , m_mem(m_shape.Count())
+        , m_scale(p_perColumn ? m_shape.ColNum() : 1)
+        , m_perColumn(p_perColumn)
+    {
+        std::fill(m_mem.RawMemory(), m_mem.RawMemory() + m_shape.Count(), (int8_t)0);
+        std::fill(m_scale.RawMemory(), m_scale.RawMemory() + ScaleNum(), ElementType{});
+    }
+
+    explicit QuantizedMatrix(size_t p_rowNum, size_t p_colNum, bool p_perColumn = true)
+        : QuantizedMatrix(MetaNN::Shape<CategoryTag>(p_rowNum, p_colNum), p_perColumn)
+    {}
+
+    /// Symmetric quantization: the largest magnitude of a column (or of the matrix) maps to 127.
+    explicit QuantizedMatrix(const Matrix<TElem, TDevice>& p_ori, bool p_perColumn = true)
+        : QuantizedMatrix(p_ori.Shape(), p_perColumn)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        const size_t rowNum = m_shape.RowNum();
+        const size_t colNum = m_shape.ColNum();
+        const TElem* mem_in = LowerAccess(p_ori).RawMemory();
+
+        std::vector<float> maxVal(ScaleNum(), 0);
+        for (size_t i = 0; i < rowNum; ++i)
+        {
+            for (size_t j = 0; j < colNum; ++j)
+            {
+                float& curMax = maxVal[m_perColumn ? j : 0];
+                curMax = std::max(curMax, (float)std::fabs((float)mem_in[i * colNum + j]));
+            }
+        }
+
+        std::vector<float> invScale(ScaleNum());
+        for (size_t s = 0; s < ScaleNum(); ++s)
+        {
+            m_scale.RawMemory()[s] = static_cast<ElementType>(maxVal[s] / 127);
+            invScale[s] = (maxVal[s] > 0) ? (127 / maxVal[s]) : 0;
+        }
+
+        int8_t* mem_out = m_mem.RawMemory();
+        for (size_t i = 0; i < rowNum; ++i)
+        {
+            for (size_t j = 0; j < colNum; ++j)
+            {
+                const float q = std::round((float)mem_in[j] * invScale[m_perColumn ? j : 0]);
+                mem_out[j] = (int8_t)std::clamp(q, -127.f, 127.f);
+            }
+            mem_in += colNum;
+            mem_out += colNum;
+        }
+    }
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    bool IsPerColumn() const noexcept
+    {
+        return m_perColumn;
+    }
+
+    bool operator== (const QuantizedMatrix& val) const
+    {
+        return (m_shape == val.m_shape) &&
+               (m_mem == val.m_mem) &&
+               (m_scale == val.m_scale);
+    }
+
+    auto operator () (size_t p_rowId, size_t p_colId) const
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        if ((p_rowId >= m_shape.RowNum()) || (p_colId >= m_shape.ColNum()))
+        {
+            throw std::runtime_error("Invalid index for QuantizedMatrix");
+        }
+        const auto scale = (m_scale.RawMemory())[m_perColumn ? p_colId : 0];
+        return static_cast<ElementType>(scale * (m_mem.RawMemory())[p_rowId * m_shape.ColNum() + p_colId]);
+    }
+
+    auto EvalRegister() const
+    {
+        using TEvalItem = NSQuantizedMatrix::EvalItem<ElementType, DeviceType>;
+        using TEvalGroup = NSQuantizedMatrix::EvalGroup<ElementType, DeviceType>;
+        using TItemDispatcher = TrivalEvalItemDispatcher<TEvalGroup>;
+
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                EvalPlan<DeviceType>::Inst().template Register<TItemDispatcher>(
+                    std::make_unique<TEvalItem>(std::move(evalHandle), *this));
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+private:
+    size_t ScaleNum() const noexcept
+    {
+        return m_perColumn ? m_shape.ColNum() : 1;
+    }
+
+private:
+    MetaNN::Shape<CategoryTag> m_shape;
+    ContinuousMemory<int8_t, DeviceType> m_mem;
+    ContinuousMemory<ElementType, DeviceType> m_scale;
+    bool m_perColumn;
+    EvalBuffer<Matrix<ElementType, DeviceType>> m_evalBuf;
+};
+
+template<typename TElem, typename TDevice>
+struct LowerAccessImpl<QuantizedMatrix<TElem, TDevice>>
+{
+    LowerAccessImpl(QuantizedMatrix<TElem, TDevice> p)
+        : m_data(std::move(p))
+    {}
+
+    const int8_t* RawMemory() const
+    {
+        return m_data.m_mem.RawMemory();
+    }
+
+    TElem ColScale(size_t p_colId) const
+    {
+        return (m_data.m_scale.RawMemory())[m_data.m_perColumn ? p_colId : 0];
+    }
+
+private:
+    QuantizedMatrix<TElem, TDevice> m_data;
+};
+
+template <typename T>
+constexpr bool IsQuantizedMatrix = false;
+
+template <typename TElem, typename TDevice>
+constexpr bool IsQuantizedMatrix<QuantizedMatrix<TElem, TDevice>> = true;
+}
@@ -109,4 +109,10 @@ private:
     TScalar  m_scalar;
     EvalBuffer<Matrix<ElementType, DeviceType>> m_evalBuf;
 };
+
+template <typename T>
+constexpr bool IsTrivalMatrix = false;
+
+template <typename TScalar>
+constexpr bool IsTrivalMatrix<TrivalMatrix<TScalar>> = true;
 }
@@ -93,6 +93,11 @@ struct LowerAccessImpl<Scalar<TElem, TDevice>>
         return m_data.m_mem.RawMemory();
     }
 
+    const auto& SharedMemory() const
+    {
+        return m_data.m_mem;
+    }
+
 private:
     Scalar<TElem, TDevice> m_data;
 };
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <MetaNN/data/facilities/low_precision.h>
 #include <MetaNN/data/cardinal/_.h>
 #include <MetaNN/data/batch/_.h>
 #include <MetaNN/data/general/_.h>
@@ -2,6 +2,8 @@
 
 #include <MetaNN/data/facilities/allocators.h>
 #include <MetaNN/facilities/traits.h>
+#include <memory>
+
 namespace MetaNN
 {
 template <typename TElem, typename TDevice>
@@ -15,6 +17,18 @@ public:
         : m_mem(Allocator<TDevice>::template Allocate<ElementType>(p_size))
     {}
 
+    /// Use memory that is not from Allocator, p_mem decides how it is released.
+    explicit ContinuousMemory(std::shared_ptr<ElementType> p_mem)
+        : m_mem(std::move(p_mem))
+    {}
+
+    /// Adopt a caller-owned buffer without copying: p_release(p_mem) is called when
+    /// the last data sharing the buffer is destroyed.
+    template <typename TRelease>
+    ContinuousMemory(ElementType* p_mem, TRelease p_release)
+        : m_mem(p_mem, std::move(p_release))
+    {}
+
     ContinuousMemory Shift(size_t pos) const
     {
         return ContinuousMemory(m_mem, pos);
@@ -40,6 +54,12 @@ public:
         return !(operator==(val));
     }
 
+    /// Whether the two objects are slices (see Shift) of the same allocation.
+    bool SameOwner(const ContinuousMemory& val) const noexcept
+    {
+        return !m_mem.owner_before(val.m_mem) && !val.m_mem.owner_before(m_mem);
+    }
+
 private:
     ContinuousMemory(const std::shared_ptr<ElementType>& owner, size_t p_shift)
         : m_mem(owner, owner.get() + p_shift)
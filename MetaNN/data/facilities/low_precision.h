@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+namespace MetaNN
+{
+namespace NSLowPrecision
+{
+    inline uint32_t FloatBits(float val)
+    {
+        uint32_t res;
+        memcpy(&res, &val, sizeof(float));
+        return res;
+    }
+
+    inline float BitsFloat(uint32_t val)
+    {
+        float res;
+        memcpy(&res, &val, sizeof(float));
+        return res;
+    }
+
+    // IEEE 754 binary16, round to nearest even.
+    inline uint16_t FloatToHalf(float val)
+    {
+        uint32_t x = FloatBits(val);
+        const uint32_t sign = (x >> 16) & 0x8000;
+        x &= 0x7fffffff;
+
+        if (x >= 0x47800000)
+        {
+            // overflow to infinity, or keep nan as a quiet nan.
+            return (uint16_t)(sign | ((x > 0x7f800000) ? 0x7e00 : 0x7c00));
+        }
+        if (x < 0x38800000)
+        {
+            // zero or subnormal: let the FPU shift and round the mantissa.
+            const uint32_t r = FloatBits(BitsFloat(x) + 0.5f);
+            return (uint16_t)(sign | (r - 0x3f000000));
+        }
+
+        const uint32_t mantOdd = (x >> 13) & 1;
+        x += 0xc8000fff + mantOdd;
+        return (uint16_t)(sign | (x >> 13));
+    }
+
+    inline float HalfToFloat(uint16_t val)
+    {
+        const uint32_t sign = (uint32_t)(val & 0x8000) << 16;
+        const uint32_t exponent = (val >> 10) & 0x1f;
+        const uint32_t mant = val & 0x3ff;
+
+        if (exponent == 0)
+        {
+            const float res = (float)mant * 5.9604644775390625e-8f;
+            return (sign != 0) ? -res : res;
+        }
+        if (exponent == 0x1f)
+        {
+            return BitsFloat(sign | 0x7f800000 | (mant << 13));
+        }
+        return BitsFloat(sign | ((exponent + 112) << 23) | (mant << 13));
+    }
+
+    // bfloat16 keeps the exponent of float and the upper 7 bits of its mantissa.
+    inline uint16_t FloatToBHalf(float val)
+    {
+        uint32_t x = FloatBits(val);
+        if ((x & 0x7fffffff) > 0x7f800000)
+        {
+            return (uint16_t)((x >> 16) | 0x40);
+        }
+        x += 0x7fff + ((x >> 16) & 1);
+        return (uint16_t)(x >> 16);
+    }
+
+    inline float BHalfToFloat(uint16_t val)
+    {
+        return BitsFloat((uint32_t)val << 16);
+    }
+
+    /// Storage-only 16-bit element: values are converted to float for every
+    /// arithmetic operation and rounded back when stored.
+    template <uint16_t(*TEncode)(float), float(*TDecode)(uint16_t)>
+    class SoftFloat16
+    {
+    public:
+        SoftFloat16() = default;
+
+        SoftFloat16(float val)
+            : m_bits(TEncode(val))
+        {}
+
+        operator float() const
+        {
+            return TDecode(m_bits);
+        }
+
+        SoftFloat16& operator+= (float val)
+        {
+            return *this = SoftFloat16((float)(*this) + val);
+        }
+
+        SoftFloat16& operator-= (float val)
+        {
+            return *this = SoftFloat16((float)(*this) - val);
+        }
+
+        SoftFloat16& operator*= (float val)
+        {
+            return *this = SoftFloat16((float)(*this) * val);
+        }
+
+        SoftFloat16& operator/= (float val)
+        {
+            return *this = SoftFloat16((float)(*this) / val);
+        }
+
+        uint16_t Bits() const noexcept
+        {
+            return m_bits;
+        }
+
+        static SoftFloat16 FromBits(uint16_t bits)
+        {
+            SoftFloat16 res;
+            res.m_bits = bits;
+            return res;
+        }
+
+    private:
+        uint16_t m_bits = 0;
+    };
+}
+
+using Float16 = NSLowPrecision::SoftFloat16<NSLowPrecision::FloatToHalf, NSLowPrecision::HalfToFloat>;
+using BFloat16 = NSLowPrecision::SoftFloat16<NSLowPrecision::FloatToBHalf, NSLowPrecision::BHalfToFloat>;
+
+/// The type that arithmetic on an element type is carried out in:
+/// kernels accumulate in it and round to the element type only when storing.
+template <typename TElem>
+struct ComputeType_
+{
+    using type = TElem;
+};
+
+template <>
+struct ComputeType_<Float16>
+{
+    using type = float;
+};
+
+template <>
+struct ComputeType_<BFloat16>
+{
+    using type = float;
+};
+
+template <typename TElem>
+using ComputeType = typename ComputeType_<TElem>::type;
+}
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <MetaNN/data/facilities/continuous_memory.h>
+#include <MetaNN/data/facilities/shape.h>
+#include <MetaNN/data/facilities/tags.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+// POSIX only, so meta_nn.h does not include it: include this header to use MappedFile.
+#if !defined(__unix__) && !defined(__APPLE__)
+#error "MappedFile requires a POSIX platform."
+#endif
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace MetaNN
+{
+/// A file mapped into memory. Data built over it (see MapData) read the mapped pages
+/// directly, so processes mapping the same file share them through the page cache.
+/// The mapping is private: a page written by the process is copied and the file is never modified.
+/// The mapping is released when the file object and every data built over it are destroyed.
+class MappedFile
+{
+public:
+    explicit MappedFile(const std::string& path)
+    {
+        const int fd = open(path.c_str(), O_RDONLY);
+        if (fd < 0)
+        {
+            throw std::runtime_error("Cannot open file: " + path);
+        }
+
+        struct stat fileStat;
+        if ((fstat(fd, &fileStat) != 0) || (fileStat.st_size <= 0))
+        {
+            close(fd);
+            throw std::runtime_error("Cannot map file: " + path);
+        }
+        m_size = (size_t)fileStat.st_size;
+
+        void* addr = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+        {
+            throw std::runtime_error("Cannot map file: " + path);
+        }
+
+        const size_t size = m_size;
+        m_region = std::shared_ptr<char>((char*)addr, [size](char* p) { munmap(p, size); });
+    }
+
+    size_t Size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// elemNum elements of type TElem starting at byteOffset of the file.
+    template <typename TElem>
+    ContinuousMemory<TElem, DeviceTags::CPU> Memory(size_t byteOffset, size_t elemNum) const
+    {
+        if ((byteOffset > m_size) || (elemNum > (m_size - byteOffset) / sizeof(TElem)))
+        {
+            throw std::runtime_error("Mapped region out of the file.");
+        }
+        if (byteOffset % alignof(TElem) != 0)
+        {
+            throw std::runtime_error("Mapped region is not aligned.");
+        }
+        return ContinuousMemory<TElem, DeviceTags::CPU>(
+            std::shared_ptr<TElem>(m_region, (TElem*)(m_region.get() + byteOffset)));
+    }
+
+private:
+    size_t m_size;
+    std::shared_ptr<char> m_region;
+};
+
+/// Build a principal data type (Matrix, ThreeDArray, BatchMatrix...) over the file,
+/// the elements are stored from byteOffset in row-major order without any header.
+template <typename TData>
+TData MapData(const MappedFile& file, size_t byteOffset,
+              const Shape<typename TData::CategoryTag>& shape)
+{
+    using ElementType = typename TData::ElementType;
+    using DeviceType = typename TData::DeviceType;
+    static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                  "Only CPU supports this method.");
+    static_assert(std::is_same_v<PrincipalDataType<typename TData::CategoryTag, ElementType, DeviceType>, TData>,
+                  "Only principal data types can be mapped.");
+
+    return TData(file.template Memory<ElementType>(byteOffset, shape.Count()), shape);
+}
+}
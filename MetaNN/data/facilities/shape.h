@@ -16,6 +16,57 @@ template <typename T>
 constexpr bool IsCardinalTag = std::is_same_v<T, CategoryTags::Scalar> ||
                                std::is_same_v<T, CategoryTags::Matrix> ||
                                std::is_same_v<T, CategoryTags::ThreeDArray>;
+
+/// Sequence lengths of a batch together with their prefix sums: sequence i occupies the
+/// cardinal elements [Offset(i), Offset(i + 1)) of the packed data.
+class SeqLenTable
+{
+public:
+    template <typename TSeq>
+    explicit SeqLenTable(const TSeq& seq)
+    {
+        m_seqLenCont.reserve(seq.size());
+        m_offsetCont.reserve(seq.size() + 1);
+        m_offsetCont.push_back(0);
+        for (auto v : seq)
+            PushBack(v);
+    }
+
+    void PushBack(size_t seqLen)
+    {
+        m_seqLenCont.push_back(seqLen);
+        m_offsetCont.push_back(m_offsetCont.back() + seqLen);
+    }
+
+    const auto& SeqLenContainer() const noexcept
+    {
+        return m_seqLenCont;
+    }
+
+    const auto& OffsetContainer() const noexcept
+    {
+        return m_offsetCont;
+    }
+
+    size_t Offset(size_t batchID) const noexcept
+    {
+        return m_offsetCont[batchID];
+    }
+
+    size_t Total() const noexcept
+    {
+        return m_offsetCont.back();
+    }
+
+    bool operator== (const SeqLenTable& val) const
+    {
+        return m_seqLenCont == val.m_seqLenCont;
+    }
+
+private:
+    std::vector<size_t> m_seqLenCont;
+    std::vector<size_t> m_offsetCont;
+};
 }
 
 template <typename T>
@@ -267,27 +318,34 @@ public:
     template <typename TSeq = std::vector<size_t>, typename...TParams>
     explicit Shape(const TSeq& seq, TParams&&... params)
         : Shape<TSubCate>(std::forward<TParams>(params)...)
-    {
-        m_seqLenCont.reserve(seq.size());
-        for (auto v : seq)
-            m_seqLenCont.push_back(v);
-    }
+        , m_seqLens(seq)
+    {}
     
 public:
     const auto& SeqLenContainer() const noexcept
     {
-        return m_seqLenCont;
+        return m_seqLens.SeqLenContainer();
     }
     
-    auto& SeqLenContainer() noexcept
+    void PushSeqLen(size_t seqLen)
     {
-        return m_seqLenCont;
+        m_seqLens.PushBack(seqLen);
+    }
+    
+    /// Number of cardinal elements before sequence batchID, batchID can be the batch number.
+    size_t SeqOffset(size_t batchID) const noexcept
+    {
+        return m_seqLens.Offset(batchID);
+    }
+    
+    const auto& SeqOffsetContainer() const noexcept
+    {
+        return m_seqLens.OffsetContainer();
     }
     
     size_t Count() const noexcept
     {
-        return std::accumulate(m_seqLenCont.begin(), m_seqLenCont.end(), 0) *
-               Shape<TSubCate>::Count();
+        return m_seqLens.Total() * Shape<TSubCate>::Count();
     }
     
     const auto& CardinalShape() const noexcept
@@ -298,17 +356,17 @@ public:
     template <typename... TIndexParams>
     size_t Index2Count(size_t batchID, size_t seqID, TIndexParams... indexParams) const
     {
-        if (batchID >= m_seqLenCont.size())
+        if (batchID >= SeqLenContainer().size())
         {
             throw std::runtime_error("Invalid batch index for Shape<CategoryTags::BatchSequence>");
         }
         
-        if (seqID >= m_seqLenCont[batchID])
+        if (seqID >= SeqLenContainer()[batchID])
         {
             throw std::runtime_error("Invalid sequence index for Shape<CategoryTags::BatchSequence>");
         }
         
-        size_t res = std::accumulate(m_seqLenCont.begin(), m_seqLenCont.begin() + batchID, seqID);
+        size_t res = m_seqLens.Offset(batchID) + seqID;
         
         const auto& baseShape = static_cast<const Shape<TSubCate>&>(*this);
         return res * baseShape.Count() + baseShape.Index2Count(indexParams...);
@@ -316,7 +374,7 @@ public:
     
     bool operator== (const Shape& val) const
     {
-        return (m_seqLenCont == val.m_seqLenCont) &&
+        return (m_seqLens == val.m_seqLens) &&
                (Shape<TSubCate>::operator==(val));
     }
     
@@ -326,7 +384,7 @@ public:
     }
     
 private:
-    std::vector<size_t> m_seqLenCont;
+    NSShape::SeqLenTable m_seqLens;
 };
 
 template <>
@@ -339,26 +397,34 @@ public:
     
     template <typename TSeq = std::vector<size_t>>
     explicit Shape(const TSeq& seq = TSeq{})
-    {
-        m_seqLenCont.reserve(seq.size());
-        for (auto v : seq)
-            m_seqLenCont.push_back(v);
-    }
+        : m_seqLens(seq)
+    {}
     
 public:
     const auto& SeqLenContainer() const noexcept
     {
-        return m_seqLenCont;
+        return m_seqLens.SeqLenContainer();
     }
     
-    auto& SeqLenContainer() noexcept
+    void PushSeqLen(size_t seqLen)
     {
-        return m_seqLenCont;
+        m_seqLens.PushBack(seqLen);
+    }
+    
+    /// Number of cardinal elements before sequence batchID, batchID can be the batch number.
+    size_t SeqOffset(size_t batchID) const noexcept
+    {
+        return m_seqLens.Offset(batchID);
+    }
+    
+    const auto& SeqOffsetContainer() const noexcept
+    {
+        return m_seqLens.OffsetContainer();
     }
     
     size_t Count() const noexcept
     {
-        return std::accumulate(m_seqLenCont.begin(), m_seqLenCont.end(), 0);
+        return m_seqLens.Total();
     }
     
     const auto& CardinalShape() const noexcept
@@ -370,22 +436,22 @@ public:
     template <typename... TIndexParams>
     size_t Index2Count(size_t batchID, size_t seqID, TIndexParams... indexParams) const
     {
-        if (batchID >= m_seqLenCont.size())
+        if (batchID >= SeqLenContainer().size())
         {
             throw std::runtime_error("Invalid batch index for Shape<CategoryTags::BatchSequence>");
         }
         
-        if (seqID >= m_seqLenCont[batchID])
+        if (seqID >= SeqLenContainer()[batchID])
         {
             throw std::runtime_error("Invalid sequence index for Shape<CategoryTags::BatchSequence>");
         }
         
-        return std::accumulate(m_seqLenCont.begin(), m_seqLenCont.begin() + batchID, seqID);
+        return m_seqLens.Offset(batchID) + seqID;
     }
     
     bool operator== (const Shape& val) const
     {
-        return (m_seqLenCont == val.m_seqLenCont);
+        return (m_seqLens == val.m_seqLens);
     }
     
     const Shape<CategoryTags::Scalar>& Cardinal() const noexcept
@@ -395,7 +461,7 @@ public:
     }
     
 private:
-    std::vector<size_t> m_seqLenCont;
+    NSShape::SeqLenTable m_seqLens;
 };
 
 template <typename TCate>
@@ -3,6 +3,9 @@
 #include <MetaNN/data/cardinal/_.h>
 #include <MetaNN/data/batch/_.h>
 #include <MetaNN/data/sequence/_.h>
+#include <memory>
+#include <stdexcept>
+#include <variant>
 
 namespace MetaNN
 {
@@ -41,15 +44,8 @@ public:
     
     bool operator== (const TBase& val) const override final
     {
-        try
-        {
-            const DynamicWrapper& real = dynamic_cast<const DynamicWrapper&>(val);
-            return m_internal == real.m_internal;
-        }
-        catch(std::bad_cast&)
-        {
-            return false;
-        }
+        const DynamicWrapper* real = dynamic_cast<const DynamicWrapper*>(&val);
+        return real && (m_internal == real->m_internal);
     }
 
     DynamicConstEvalHandle<typename TBase::EvalType> EvalRegister() const override final
@@ -66,10 +62,14 @@ private:
     TInternalData m_internal;
 };
 
+/// Type-erased data of a category. The principal type of the category is stored inline,
+/// so wrapping and evaluating it neither allocates a wrapper nor goes through virtual calls;
+/// other types are held by a DynamicWrapper.
 template <typename TElem, typename TDevice, typename TDataCate>
 class DynamicData
 {
     using InternalType = DynamicBase<TElem, TDevice, TDataCate>;
+    using EvalType = typename InternalType::EvalType;
     
 public:
     using ElementType = TElem;
@@ -79,60 +79,90 @@ public:
 public:
     DynamicData() = default;
     
+    explicit DynamicData(EvalType data)
+        : m_internal(std::in_place_index<1>, std::move(data)) {}
+    
     template <typename TOriData>
     DynamicData(std::shared_ptr<DynamicWrapper<TOriData>> data)
     {
-        m_internal = std::move(data);
+        if (data)
+        {
+            m_internal.template emplace<2>(std::move(data));
+        }
     }
     
     const auto& Shape() const
     {
-        if (!m_internal)
+        if (auto inlinePtr = std::get_if<1>(&m_internal))
         {
-            throw std::runtime_error("Invalid internal buffer");
+            return inlinePtr->Shape();
         }
-        return m_internal->Shape();
+        return Wrapper().Shape();
     }
 
-    auto EvalRegister() const
+    DynamicConstEvalHandle<EvalType> EvalRegister() const
     {
-        if (!m_internal)
+        if (auto inlinePtr = std::get_if<1>(&m_internal))
         {
-            throw std::runtime_error("Invalid internal buffer");
+            return inlinePtr->EvalRegister();
         }
-        return m_internal->EvalRegister();
+        return Wrapper().EvalRegister();
     }
     
     bool operator== (const DynamicData& val) const
     {
-        if ((!m_internal) && (!val.m_internal))
+        if (m_internal.index() != val.m_internal.index())
         {
-            return true;
+            return false;
         }
-        if ((!m_internal) || (!val.m_internal))
+        switch (m_internal.index())
         {
-            return false;
+        case 0:
+            return true;
+        case 1:
+            return std::get<1>(m_internal) == std::get<1>(val.m_internal);
+        default:
+            return *std::get<2>(m_internal) == *std::get<2>(val.m_internal);
         }
-        InternalType& val1 = *m_internal;
-        InternalType& val2 = *(val.m_internal);
-        return val1 == val2;
     }
 
     template <typename T>
     const T* TryCastTo() const
     {
-        const auto* ptr = m_internal.get();
-        auto ptrCast = dynamic_cast<const DynamicWrapper<T>*>(ptr);
-
+        if constexpr (std::is_same_v<T, EvalType>)
+        {
+            if (auto inlinePtr = std::get_if<1>(&m_internal))
+            {
+                return inlinePtr;
+            }
+        }
+        auto wrapperPtr = std::get_if<2>(&m_internal);
+        if (!wrapperPtr)
+        {
+            return nullptr;
+        }
+        auto ptrCast = dynamic_cast<const DynamicWrapper<T>*>(wrapperPtr->get());
         return (ptrCast ? &(ptrCast->Internal()) : nullptr);
     }
     
     bool IsEmpty() const
     {
-        return m_internal == nullptr;
+        return m_internal.index() == 0;
     }
+
 private:
-    std::shared_ptr<InternalType> m_internal;
+    const InternalType& Wrapper() const
+    {
+        auto wrapperPtr = std::get_if<2>(&m_internal);
+        if (!wrapperPtr)
+        {
+            throw std::runtime_error("Invalid internal buffer");
+        }
+        return **wrapperPtr;
+    }
+
+private:
+    std::variant<std::monostate, EvalType, std::shared_ptr<InternalType>> m_internal;
 };
 
 template <typename TData>
@@ -163,11 +193,21 @@ auto MakeDynamic(TData&& data)
     else
     {
         using RawData = RemConstRef<TData>;
-        using TDeriveData = DynamicWrapper<RawData>;
-        auto internal = std::make_shared<TDeriveData>(std::forward<TData>(data));
-        return DynamicData<typename RawData::ElementType,
-                           typename RawData::DeviceType,
-                           DataCategory<RawData>>(std::move(internal));
+        using ResType = DynamicData<typename RawData::ElementType,
+                                    typename RawData::DeviceType,
+                                    DataCategory<RawData>>;
+        if constexpr (std::is_same_v<RawData, PrincipalDataType<DataCategory<RawData>,
+                                                                typename RawData::ElementType,
+                                                                typename RawData::DeviceType>>)
+        {
+            return ResType(std::forward<TData>(data));
+        }
+        else
+        {
+            using TDeriveData = DynamicWrapper<RawData>;
+            auto internal = std::make_shared<TDeriveData>(std::forward<TData>(data));
+            return ResType(std::move(internal));
+        }
     }
 }
 }
@@ -97,4 +97,10 @@ namespace MetaNN
         MetaNN::Shape<CategoryTag> m_shape;
         EvalBuffer<PrincipalDataType<CategoryTag, ElementType, DeviceType>> m_evalBuf;
     };
-}
\ No newline at end of file
+
+    template <typename T>
+    constexpr bool IsZeroData = false;
+
+    template <typename TCategory, typename TElem, typename TDevice>
+    constexpr bool IsZeroData<ZeroData<TCategory, TElem, TDevice>> = true;
+}
@@ -2,3 +2,4 @@
 
 #include <MetaNN/data/linear_table/static_array.h>
 #include <MetaNN/data/linear_table/dynamic_array.h>
+#include <MetaNN/data/linear_table/array_builder.h>
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <MetaNN/data/facilities/continuous_memory.h>
+#include <MetaNN/data/facilities/lower_access.h>
+#include <MetaNN/data/facilities/shape.h>
+#include <MetaNN/data/facilities/tags.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/data/linear_table/static_array.h>
+#include <cstring>
+#include <stdexcept>
+
+namespace MetaNN
+{
+/// Assembles a batch or a sequence element by element in one buffer allocated for
+/// `capacity` elements. Build() wraps the filled part as a StaticArray without copying.
+template <typename TElem, typename TDevice,
+          template<typename> class TCateWrapper, typename TCardinalCate>
+class StaticArrayBuilder
+{
+    static_assert(!IsBatchSequenceCategoryTag<TCateWrapper<TCardinalCate>>,
+                  "Batch sequences do not have a fixed element size.");
+public:
+    using CategoryTag = TCateWrapper<TCardinalCate>;
+    using ElementType = TElem;
+    using DeviceType = TDevice;
+    using CardinalType = PrincipalDataType<TCardinalCate, ElementType, DeviceType>;
+    using ResType = StaticArray<TElem, TDevice, TCateWrapper, TCardinalCate>;
+
+public:
+    StaticArrayBuilder(MetaNN::Shape<TCardinalCate> p_cardinalShape, size_t p_capacity)
+        : m_cardinalShape(std::move(p_cardinalShape))
+        , m_capacity(p_capacity)
+        , m_size(0)
+        , m_mem(m_cardinalShape.Count() * p_capacity)
+    {}
+
+    size_t Size() const noexcept
+    {
+        return m_size;
+    }
+
+    size_t Capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// Reserve the next element and return it. It shares memory with the buffer,
+    /// so writing it through LowerAccess fills the result in place.
+    CardinalType Append()
+    {
+        if (m_size >= m_capacity)
+        {
+            throw std::runtime_error("StaticArrayBuilder is full.");
+        }
+        const size_t pos = m_size * m_cardinalShape.Count();
+        ++m_size;
+        return CardinalType(m_mem.Shift(pos), m_cardinalShape);
+    }
+
+    void PushBack(const CardinalType& data)
+    {
+        static_assert(std::is_same_v<DeviceType, DeviceTags::CPU>,
+                      "Only CPU supports this method.");
+
+        if (data.Shape() != m_cardinalShape)
+        {
+            throw std::runtime_error("Shape mismatch");
+        }
+        auto slot = Append();
+        auto lowSlot = LowerAccess(slot);
+        memcpy(lowSlot.MutableRawMemory(), LowerAccess(data).RawMemory(),
+               sizeof(ElementType) * m_cardinalShape.Count());
+    }
+
+    ResType Build() const
+    {
+        return ResType(m_mem, MetaNN::Shape<CategoryTag>(m_size, m_cardinalShape));
+    }
+
+private:
+    MetaNN::Shape<TCardinalCate> m_cardinalShape;
+    size_t m_capacity;
+    size_t m_size;
+    ContinuousMemory<ElementType, DeviceType> m_mem;
+};
+}
@@ -6,7 +6,10 @@
 #include <MetaNN/facilities/traits.h>
 #include <MetaNN/evaluate/eval_buffer.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <cstring>
 #include <memory>
+#include <optional>
+#include <vector>
 
 namespace MetaNN
 {
@@ -75,7 +78,7 @@ struct Helper_<CategoryTags::Sequence<TOriCate>, CategoryTags::Batch>
     {
         if (proShape.Cardinal() != oriShape.Cardinal())
             return false;
-        proShape.SeqLenContainer().push_back(oriShape.Length());
+        proShape.PushSeqLen(oriShape.Length());
         return true;
     }
 };
@@ -101,6 +104,37 @@ struct Helper_<CategoryTags::Sequence<TOriCate>, CategoryTags::Batch>
         MetaNN::Shape<TCategory> m_outputShape;
     };
     
+    // Returns the memory of the first element if the elements are adjacent slices of one
+    // buffer (such as the results of StaticArray::operator[]), so they can be wrapped without copying.
+    template <typename TInputHandle>
+    auto JoinSlices(const std::vector<TInputHandle>& inputs)
+    {
+        using TData = typename TInputHandle::DataType;
+        using TElem = typename TData::ElementType;
+        using ResType = RemConstRef<decltype(LowerAccess(std::declval<TData>()).SharedMemory())>;
+
+        std::optional<ResType> res;
+        if (inputs.empty())
+        {
+            return res;
+        }
+
+        ResType first = LowerAccess(inputs[0].Data()).SharedMemory();
+        const TElem* expectPos = first.RawMemory();
+        for (const auto& handle : inputs)
+        {
+            const auto& curItem = handle.Data();
+            ResType curMem = LowerAccess(curItem).SharedMemory();
+            if ((curMem.RawMemory() != expectPos) || (!curMem.SameOwner(first)))
+            {
+                return res;
+            }
+            expectPos += curItem.Shape().Count();
+        }
+        res = std::move(first);
+        return res;
+    }
+
     template <typename TInputHandle, typename TElement, typename TDevice, typename TCategory>
     class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle, TElement, TDevice, TCategory>>
     {
@@ -115,6 +149,12 @@ struct Helper_<CategoryTags::Sequence<TOriCate>, CategoryTags::Batch>
             static_assert(std::is_same_v<TDevice, DeviceTags::CPU>,
                           "Currently only CPU is supported");
 
+            if (auto joined = JoinSlices(evalItem.m_inputs); joined)
+            {
+                evalItem.m_output.SetData(ResType(std::move(*joined), evalItem.m_outputShape));
+                return;
+            }
+
             auto lowerRes = LowerAccess(res);
             TElem* resMem = lowerRes.MutableRawMemory();
         
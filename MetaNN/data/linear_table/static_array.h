@@ -119,10 +119,8 @@ public:
                 throw std::runtime_error("ID out of bound.");
             }
             
-            size_t pos = std::accumulate(seqLenCont.begin(), seqLenCont.begin() + id, 0);
-            
             const MetaNN::Shape<TCardinalCate>& cardinalShape = m_shape.Cardinal();
-            pos *= cardinalShape.Count();
+            const size_t pos = m_shape.SeqOffset(id) * cardinalShape.Count();
             
             using AimType = PrincipalDataType<CategoryTags::Sequence<TCardinalCate>, ElementType, DeviceType>;
             const MetaNN::Shape<CategoryTags::Sequence<TCardinalCate>> aimShape(seqLenCont[id], cardinalShape);
@@ -170,6 +168,11 @@ struct LowerAccessImpl<StaticArray<TElement, TDevice, TCateWrapper, TCardinalCat
         return m_data.m_mem.RawMemory();
     }
 
+    const auto& SharedMemory() const
+    {
+        return m_data.m_mem;
+    }
+
 private:
     StaticArray<TElement, TDevice, TCateWrapper, TCardinalCate> m_data;
 };
@@ -4,6 +4,7 @@
 #include <memory>
 #include <stdexcept>
 #include <type_traits>
+#include <variant>
 
 namespace MetaNN
 {
@@ -167,6 +168,9 @@ private:
 };
 }
 
+/// Type-erased const handle. A ConstEvalHandle of TData itself (the handle of principal data)
+/// is kept inline, so it is built and read without allocation or virtual calls; other
+/// handles go through a shared DynamicHandleData.
 template <typename TData>
 class DynamicConstEvalHandle
 {
@@ -175,23 +179,46 @@ public:
     using DataType = TData;
     template <typename TRealHandle>
     DynamicConstEvalHandle(TRealHandle data)
-        : m_data(std::make_shared<NSEvalHandle::DynamicHandleData<TRealHandle>>(std::move(data)))
-    {
-        assert(m_data);
-    }
+        : m_data(Wrap(std::move(data)))
+    {}
     
     const TData& Data() const
     {
-        return m_data->Data();
+        if (auto inlinePtr = std::get_if<0>(&m_data))
+        {
+            return inlinePtr->Data();
+        }
+        return std::get<1>(m_data)->Data();
     }
     
     const void* DataPtr() const
     {
-        return m_data->DataPtr();
+        if (auto inlinePtr = std::get_if<0>(&m_data))
+        {
+            return inlinePtr->DataPtr();
+        }
+        return std::get<1>(m_data)->DataPtr();
     }
     
 private:
-    std::shared_ptr<TBaseData> m_data;
+    using TStorage = std::variant<ConstEvalHandle<TData>, std::shared_ptr<TBaseData>>;
+
+    template <typename TRealHandle>
+    static TStorage Wrap(TRealHandle data)
+    {
+        if constexpr (std::is_same_v<TRealHandle, ConstEvalHandle<TData>>)
+        {
+            return TStorage(std::in_place_index<0>, std::move(data));
+        }
+        else
+        {
+            return TStorage(std::in_place_index<1>,
+                            std::make_shared<NSEvalHandle::DynamicHandleData<TRealHandle>>(std::move(data)));
+        }
+    }
+
+private:
+    TStorage m_data;
 };
 
 template<typename THandle>
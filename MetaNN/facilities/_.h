@@ -2,5 +2,7 @@
 
 #include <MetaNN/facilities/cont_metafuns/_.h>
 #include <MetaNN/facilities/null_param.h>
+#include <MetaNN/facilities/simd.h>
+#include <MetaNN/facilities/thread_pool.h>
 #include <MetaNN/facilities/traits.h>
 #include <MetaNN/facilities/var_type_dict.h>
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define METANN_X86_DISPATCH
+#endif
+
+// Small helpers called from the per-target kernel variants must be inlined into them: a call
+// that passes wide vectors would otherwise follow the ABI of a different target.
+#if defined(__GNUC__) || defined(__clang__)
+#define METANN_ALWAYS_INLINE __attribute__((always_inline)) inline
+#else
+#define METANN_ALWAYS_INLINE inline
+#endif
+
+namespace MetaNN
+{
+/// Widest vector extension usable on the running CPU. Kernels are compiled once per level
+/// (with target attributes) and pick the variant at run time, so the library itself does
+/// not need to be built with -mavx2 or -mavx512f.
+enum class SimdLevel
+{
+    Generic,
+    Avx2,
+    Avx512
+};
+
+inline SimdLevel DetectSimdLevel()
+{
+#ifdef METANN_X86_DISPATCH
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx512f"))
+    {
+        return SimdLevel::Avx512;
+    }
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    {
+        return SimdLevel::Avx2;
+    }
+#endif
+    return SimdLevel::Generic;
+}
+
+inline SimdLevel CpuSimdLevel()
+{
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+template <typename TElem, size_t Bytes>
+struct SimdVec_
+{
+    typedef TElem type __attribute__((vector_size(Bytes)));
+};
+
+template <typename TElem, size_t Bytes>
+using SimdVec = typename SimdVec_<TElem, Bytes>::type;
+#endif
+}
@@ -0,0 +1,185 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace MetaNN
+{
+/// Process-wide pool of hardware_concurrency() - 1 workers used by CPU kernels to split
+/// independent work. The calling thread takes part in every job. A ParallelFor issued from
+/// inside a task, or while another thread owns the pool, runs serially on the caller.
+class ThreadPool
+{
+public:
+    static ThreadPool& Inst()
+    {
+        static ThreadPool inst(DefaultWorkerNum());
+        return inst;
+    }
+
+    /// A pool with a fixed number of workers, e.g. to exercise the scheduling on any machine.
+    explicit ThreadPool(size_t workerNum)
+    {
+        for (size_t i = 0; i < workerNum; ++i)
+        {
+            m_workers.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator= (const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_stop = true;
+        }
+        m_wakeUp.notify_all();
+        for (auto& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    size_t ThreadNum() const noexcept
+    {
+        return m_workers.size() + 1;
+    }
+
+    /// Calls fun(i) for every i in [0, taskNum) and returns when all calls have finished.
+    /// The first exception thrown by a task is rethrown here.
+    template <typename TFun>
+    void ParallelFor(size_t taskNum, TFun&& fun)
+    {
+        std::unique_lock<std::mutex> jobLock(m_jobMutex, std::try_to_lock);
+        if ((taskNum <= 1) || m_workers.empty() || InTask() || !jobLock.owns_lock())
+        {
+            for (size_t i = 0; i < taskNum; ++i)
+            {
+                fun(i);
+            }
+            return;
+        }
+
+        auto job = std::make_shared<Job>([&fun](size_t i) { fun(i); }, taskNum);
+        {
+            std::lock_guard<std::mutex> guard(m_mutex);
+            m_job = job;
+            ++m_generation;
+        }
+        m_wakeUp.notify_all();
+
+        InTask() = true;
+        RunTasks(*job);
+        InTask() = false;
+
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [&job] { return job->m_pending == 0; });
+        m_job = nullptr;
+        if (job->m_error)
+        {
+            std::rethrow_exception(job->m_error);
+        }
+    }
+
+private:
+    static size_t DefaultWorkerNum()
+    {
+        const size_t hardwareNum = std::thread::hardware_concurrency();
+        return (hardwareNum > 1) ? hardwareNum - 1 : 0;
+    }
+
+    static bool& InTask()
+    {
+        thread_local bool inTask = false;
+        return inTask;
+    }
+
+    // Every ParallelFor gets its own job, and a worker only runs tasks of the job it took
+    // under m_mutex. A worker that wakes up late for a finished job finds no index left
+    // in it and cannot touch the state of the next one.
+    struct Job
+    {
+        Job(std::function<void(size_t)> task, size_t taskNum)
+            : m_task(std::move(task))
+            , m_taskNum(taskNum)
+            , m_pending(taskNum)
+        {}
+
+        const std::function<void(size_t)> m_task;
+        const size_t m_taskNum;
+        std::atomic<size_t> m_next{0};
+        std::atomic<size_t> m_pending;
+        std::exception_ptr m_error;
+    };
+
+    void RunTasks(Job& job)
+    {
+        size_t i;
+        while ((i = job.m_next.fetch_add(1)) < job.m_taskNum)
+        {
+            try
+            {
+                job.m_task(i);
+            }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                if (!job.m_error)
+                {
+                    job.m_error = std::current_exception();
+                }
+            }
+            if (job.m_pending.fetch_sub(1) == 1)
+            {
+                std::lock_guard<std::mutex> guard(m_mutex);
+                m_done.notify_all();
+            }
+        }
+    }
+
+    void WorkerLoop()
+    {
+        InTask() = true;
+        size_t seenGeneration = 0;
+        while (true)
+        {
+            std::shared_ptr<Job> job;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_wakeUp.wait(lock, [this, seenGeneration] { return m_stop || (m_generation != seenGeneration); });
+                if (m_stop)
+                {
+                    return;
+                }
+                seenGeneration = m_generation;
+                job = m_job;
+            }
+            if (job)
+            {
+                RunTasks(*job);
+            }
+        }
+    }
+
+private:
+    std::vector<std::thread> m_workers;
+
+    std::mutex m_jobMutex;
+    std::mutex m_mutex;
+    std::condition_variable m_wakeUp;
+    std::condition_variable m_done;
+
+    std::shared_ptr<Job> m_job;
+    size_t m_generation = 0;
+    bool m_stop = false;
+};
+}
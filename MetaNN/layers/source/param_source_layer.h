@@ -85,6 +85,11 @@ namespace MetaNN
                 }
                 loadBuffer.Set(m_paramName, m_data);
             }
+            else if constexpr (IsQuantizedMatrix<ParamType> || IsPackedMatrix<ParamType>)
+            {
+                // inference-only storage: convert the trained parameter once when it is loaded.
+                LoadConverted(loadBuffer);
+            }
         }
         
         template <typename TSave>
@@ -141,6 +146,30 @@ namespace MetaNN
             return LayerInputCont<ParamSourceLayer>();
         }
 
+    private:
+        template <typename TBuffer>
+        void LoadConverted(TBuffer& loadBuffer)
+        {
+            // there is nothing to initialize an inference-only weight from.
+            auto matPtr = loadBuffer.template TryGet<ParamCategory>(m_paramName);
+            if (!matPtr)
+            {
+                throw std::runtime_error("Load parameter error: parameter not found: " + m_paramName);
+            }
+            if (matPtr->Shape() != m_data.Shape())
+            {
+                throw std::runtime_error("Load parameter error: shape mismatch");
+            }
+            if constexpr (IsQuantizedMatrix<ParamType>)
+            {
+                m_data = ParamType(*matPtr, m_data.IsPerColumn());
+            }
+            else
+            {
+                m_data = ParamType(*matPtr);
+            }
+        }
+
     private:
         std::string m_name;
         std::string m_paramName;
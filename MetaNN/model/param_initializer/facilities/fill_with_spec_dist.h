@@ -1,5 +1,6 @@
 #pragma once
 
+#include <MetaNN/data/facilities/low_precision.h>
 #include <random>
 
 namespace MetaNN
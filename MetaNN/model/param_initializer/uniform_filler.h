@@ -31,7 +31,7 @@ public:
         using ElementType = typename TData::ElementType;
         using DistType = std::conditional_t<std::is_integral<ElementType>::value,
                                             std::uniform_int_distribution<ElementType>,
-                                            std::uniform_real_distribution<ElementType>>;
+                                            std::uniform_real_distribution<ComputeType<ElementType>>>;
         DistType dist(m_min, m_max);
         NSInitializer::FillWithDist(data, dist, m_engine);
     }
@@ -101,13 +101,13 @@ namespace MetaNN
             if constexpr (std::is_same<DistType, VarScaleFillerPolicy::DistributeTypeCate::Uniform>::value)
             {
                 double limit = sqrt(3.0 * m_factor / fan_factor);
-                std::uniform_real_distribution<ElementType> dist(-limit, limit);
+                std::uniform_real_distribution<ComputeType<ElementType>> dist(-limit, limit);
                 NSInitializer::FillWithDist(data, dist, m_engine);
             }
             else if constexpr (std::is_same<DistType, VarScaleFillerPolicy::DistributeTypeCate::Norm>::value)
             {
                 double stddev = sqrt(m_factor / fan_factor);
-                std::normal_distribution<ElementType> dist(0, stddev);
+                std::normal_distribution<ComputeType<ElementType>> dist(0, stddev);
                 NSInitializer::FillWithDist(data, dist, m_engine);
             }
             else
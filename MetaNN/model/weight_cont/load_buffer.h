@@ -112,4 +112,28 @@ namespace MetaNN
         std::unordered_map<std::string, Matrix<TElem, TDevice>> m_matrixParam;
         std::unordered_map<std::string, ThreeDArray<TElem, TDevice>> m_3dArrayParam;
     };
+
+    /// Convert a trained matrix parameter to int8 storage for inference.
+    template <typename TElem, typename TDevice>
+    auto QuantizeParam(const LoadBuffer<TElem, TDevice>& buffer, const std::string& name, bool perColumn = true)
+    {
+        auto matPtr = buffer.template TryGet<CategoryTags::Matrix>(name);
+        if (!matPtr)
+        {
+            throw std::runtime_error("Parameter not found: " + name);
+        }
+        return QuantizedMatrix<TElem, TDevice>(*matPtr, perColumn);
+    }
+
+    /// Convert a trained matrix parameter to the packed-panel layout for inference.
+    template <typename TElem, typename TDevice>
+    auto PackParam(const LoadBuffer<TElem, TDevice>& buffer, const std::string& name)
+    {
+        auto matPtr = buffer.template TryGet<CategoryTags::Matrix>(name);
+        if (!matPtr)
+        {
+            throw std::runtime_error("Parameter not found: " + name);
+        }
+        return PackedMatrix<TElem, TDevice>(*matPtr);
+    }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
 #include <cassert>
 #include <type_traits>
@@ -14,6 +15,22 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperReLU
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in)
+        {
+            const T zero{};
+            out = (in > zero) ? in : zero;
+        }
+    };
+}
+
 namespace OperReLU::NSCaseGen
 {
     template <typename TInputHandle, typename TOutputHandle>
@@ -57,11 +74,7 @@ namespace OperReLU::NSCaseGen
             static_assert(std::is_same_v<typename EvalItemType::DeviceType, DeviceTags::CPU>,
                           "Currently only CPU is supported");
         
-            const ElementType zero{};
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = (mem_in[i] > zero) ? mem_in[i] : zero;
-            }
+            NSElementwiseEngine::Map<OperReLU::Fun>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -86,6 +99,22 @@ auto ReLU(TP&& p_m)
 /// Gradient
 namespace MetaNN
 {
+namespace OperReLUGrad
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& grad, const T& in)
+        {
+            const T zero{};
+            out = (in > zero) ? grad : zero;
+        }
+    };
+}
+
 namespace OperReLUGrad::NSCaseGen
 {
     template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
@@ -136,11 +165,7 @@ namespace OperReLUGrad::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            ElementType zero{};
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = (mem_in[i] > zero) ? mem_grad[i] : zero;
-            }
+            NSElementwiseEngine::Map<OperReLUGrad::Fun>(mem_out, count, mem_grad, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
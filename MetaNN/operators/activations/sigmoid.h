@@ -2,7 +2,9 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
+#include <MetaNN/operators/facilities/vec_math.h>
 #include <cassert>
 #include <cmath>
 #include <type_traits>
@@ -57,11 +59,8 @@ namespace OperSigmoid::NSCaseGen
             ElementType* mem_out = low_out.MutableRawMemory();
                 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
-        
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = (ElementType)(1 / (1 + exp(-mem_in[i])));
-            }
+
+            NSElementwiseEngine::Map<NSVecMath::SigmoidOp>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -85,6 +84,21 @@ auto Sigmoid(TP&& p_m)
 
 namespace MetaNN
 {
+namespace OperSigmoidGrad
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& grad, const T& in)
+        {
+            out = grad * in * (1 - in);
+        }
+    };
+}
+
 namespace OperSigmoidGrad::NSCaseGen
 {
     template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
@@ -133,11 +147,8 @@ namespace OperSigmoidGrad::NSCaseGen
             ElementType* mem_out = low_out.MutableRawMemory();
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
-        
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_grad[i] * mem_in[i] * (1 - mem_in[i]);
-            }
+
+            NSElementwiseEngine::Map<OperSigmoidGrad::Fun>(mem_out, count, mem_grad, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
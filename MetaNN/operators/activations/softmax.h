@@ -1,8 +1,10 @@
 #pragma once
 
+#include <MetaNN/data/facilities/low_precision.h>
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
+#include <MetaNN/operators/facilities/vec_math.h>
 #include <cassert>
 #include <cmath>
 #include <type_traits>
@@ -74,18 +76,35 @@ namespace OperSoftmax::NSCaseGen
     private:
         void EvalMatrix(ElementType* out, const ElementType* in, const size_t len)
         {
-            ElementType maxElem = *std::max_element(in, in + len);
-            ElementType sum{};
+            using AccType = ComputeType<ElementType>;
+            const AccType maxElem = *std::max_element(in, in + len);
+            AccType sum{};
 
-            for (size_t i = 0; i < len; ++i)
+            if constexpr (NSVecMath::IsVectorised<ElementType>)
             {
-                out[i] = exp(in[i] - maxElem);
-                sum += out[i];
+                for (size_t i = 0; i < len; ++i)
+                {
+                    out[i] = in[i] - maxElem;
+                }
+                NSVecMath::Exp(out, out, len);
+                for (size_t i = 0; i < len; ++i)
+                {
+                    sum += out[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < len; ++i)
+                {
+                    const AccType cur = exp(static_cast<AccType>(in[i]) - maxElem);
+                    out[i] = static_cast<ElementType>(cur);
+                    sum += cur;
+                }
             }
 
             for (size_t i = 0; i < len; ++i)
             {
-                out[i] /= sum;
+                out[i] = static_cast<ElementType>(out[i] / sum);
             }
         }
     };
@@ -235,7 +254,7 @@ constexpr bool Valid<Operator<OpTags::NLLLossGrad, T1, T2, T3>,
 
             for (size_t curLoop = 0; curLoop < loopCount; ++curLoop)
             {
-                ElementType sum{};
+                ComputeType<ElementType> sum{};
                 ElementType curGrad = *mem_grad;
                 for (size_t i = 0; i < cardinalCount; ++i)
                 {
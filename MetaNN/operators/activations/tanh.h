@@ -2,7 +2,9 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
+#include <MetaNN/operators/facilities/vec_math.h>
 #include <cassert>
 #include <type_traits>
 
@@ -57,10 +59,7 @@ namespace OperTanh::NSCaseGen
                 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = (ElementType)(tanh(mem_in[i]));
-            }
+            NSElementwiseEngine::Map<NSVecMath::TanhOp>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -84,6 +83,21 @@ auto Tanh(TP&& p_m)
 
 namespace MetaNN
 {
+namespace OperTanhGrad
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& grad, const T& in)
+        {
+            out = grad * (1 - in * in);
+        }
+    };
+}
+
 namespace OperTanhGrad::NSCaseGen
 {
     template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
@@ -133,11 +147,8 @@ namespace OperTanhGrad::NSCaseGen
             ElementType* mem_out = low_out.MutableRawMemory();
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
-        
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_grad[i] * (1 - mem_in[i] * mem_in[i]);
-            }
+
+            NSElementwiseEngine::Map<OperTanhGrad::Fun>(mem_out, count, mem_grad, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -1,15 +1,30 @@
 #pragma once
 
+#include <MetaNN/data/batch/batch_one_hot_vector.h>
+#include <MetaNN/data/cardinal/matrix/csr_matrix.h>
+#include <MetaNN/data/cardinal/matrix/fixed_matrix.h>
+#include <MetaNN/data/cardinal/matrix/matrix_view.h>
+#include <MetaNN/data/cardinal/matrix/packed_matrix.h>
+#include <MetaNN/data/cardinal/matrix/quantized_matrix.h>
+#include <MetaNN/data/facilities/low_precision.h>
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/blas/facilities/gemm.h>
+#include <MetaNN/operators/facilities/constant_operand.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
+#include <algorithm>
 #include <cassert>
+#include <cmath>
+#include <cstdint>
 #include <type_traits>
+#include <vector>
 
 namespace MetaNN::OpTags
 {
     struct Dot;
+    struct Duplicate;
+    struct Transpose;
 }
 
 namespace MetaNN
@@ -73,26 +88,1232 @@ namespace OperDot::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t loop = 0; loop < loopCount; ++loop)
+            if constexpr (NSGemm::IsSupported<ElementType>)
+            {
+                NSGemm::GemmBatch(false, false, loopCount, m, n, k,
+                                  mem_in1, m * k, mem_in2, k * n, mem_out, m * n);
+            }
+            else
+            {
+                for (size_t loop = 0; loop < loopCount; ++loop)
+                {
+                    for (size_t i = 0; i < m; ++i)
+                    {
+                        for (size_t j = 0; j < n; ++j)
+                        {
+                            ComputeType<ElementType> sum{};
+                            for (size_t l = 0; l < k; ++l)
+                            {
+                                sum += mem_in1[i * k + l] * mem_in2[l * n + j];
+                            }
+                            mem_out[i * n + j] = static_cast<ElementType>(sum);
+                        }
+                    }
+                    mem_out += m * n;
+                    mem_in1 += m * k;
+                    mem_in2 += k * n;
+                }
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+namespace OperDot::NSCaseStrided
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            static_assert(IsMatrix<ResType>);
+
+            const size_t m = in1.Shape().RowNum();
+            const size_t k = in1.Shape().ColNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(k == in2.Shape().RowNum());
+            ResType out(m, n);
+
+            const size_t lda = RowStride(in1);
+            const size_t ldb = RowStride(in2);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            if constexpr (NSGemm::IsSupported<ElementType>)
+            {
+                NSGemm::Gemm(false, false, m, n, k, mem_in1, lda, mem_in2, ldb, mem_out, n);
+            }
+            else
             {
                 for (size_t i = 0; i < m; ++i)
                 {
                     for (size_t j = 0; j < n; ++j)
                     {
-                        mem_out[i * n + j] = 0;
+                        ComputeType<ElementType> sum{};
                         for (size_t l = 0; l < k; ++l)
                         {
-                            mem_out[i * n + j] += mem_in1[i * k + l] * mem_in2[l * n + j];
+                            sum += mem_in1[i * lda + l] * mem_in2[l * ldb + j];
                         }
+                        mem_out[i * n + j] = static_cast<ElementType>(sum);
                     }
                 }
-                mem_out += m * n;
-                mem_in1 += m * k;
-                mem_in2 += k * n;
             }
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsMatrixView<TOperand0> && !IsMatrixView<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = StridedEvalRegister(oper.template Operand<0>());
+            auto handle2 = StridedEvalRegister(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseQuantized
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            static_assert(IsMatrix<ResType>);
+
+            const size_t m = in1.Shape().RowNum();
+            const size_t k = in1.Shape().ColNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(k == in2.Shape().RowNum());
+            ResType out(m, n);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+
+            auto low_in2 = LowerAccess(in2);
+            const int8_t* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            // The activations are quantized per row and the weight per column:
+            // out(i, j) = a_i * s_j * sum_l round(x(i, l) / a_i) * q(l, j).
+            std::vector<float> colScale(n);
+            for (size_t j = 0; j < n; ++j)
+            {
+                colScale[j] = (float)low_in2.ColScale(j);
+            }
+            std::vector<int8_t> quantized(k);
+            std::vector<int32_t> acc(n);
+            for (size_t i = 0; i < m; ++i)
+            {
+                float maxVal = 0;
+                for (size_t l = 0; l < k; ++l)
+                {
+                    maxVal = std::max(maxVal, std::fabs((float)mem_in1[l]));
+                }
+                const float actScale = maxVal / 127;
+                const float invScale = (maxVal > 0) ? (127 / maxVal) : 0;
+                for (size_t l = 0; l < k; ++l)
+                {
+                    quantized[l] = (int8_t)std::clamp(std::round((float)mem_in1[l] * invScale), -127.f, 127.f);
+                }
+
+                std::fill(acc.begin(), acc.end(), 0);
+                for (size_t l = 0; l < k; ++l)
+                {
+                    const int32_t x = quantized[l];
+                    if (x == 0)
+                    {
+                        continue;
+                    }
+                    const int8_t* w = mem_in2 + l * n;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        acc[j] += x * w[j];
+                    }
+                }
+
+                for (size_t j = 0; j < n; ++j)
+                {
+                    mem_out[j] = static_cast<ElementType>(actScale * colScale[j] * acc[j]);
+                }
+                mem_in1 += k;
+                mem_out += n;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsQuantizedMatrix<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            // keep the weight in int8: it is read by the kernel without dequantization.
+            auto handle1 = oper.template Operand<0>().EvalRegister();
+            auto handle2 = MakeConstEvalHandle(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCasePacked
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            static_assert(IsMatrix<ResType>);
+            constexpr size_t NR = RemConstRef<decltype(in2)>::PanelWidth;
+
+            const size_t m = in1.Shape().RowNum();
+            const size_t k = in1.Shape().ColNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(k == in2.Shape().RowNum());
+            ResType out(m, n);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            if constexpr (NSGemm::IsSupported<ElementType>)
+            {
+                NSGemm::GemmPackedB(false, m, n, k, mem_in1, k, mem_in2, mem_out, n);
+            }
+            else
+            {
+                for (size_t i = 0; i < m; ++i)
+                {
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        const ElementType* col = mem_in2 + (j / NR) * k * NR + j % NR;
+                        ComputeType<ElementType> sum{};
+                        for (size_t l = 0; l < k; ++l)
+                        {
+                            sum += (ComputeType<ElementType>)mem_in1[i * k + l] * col[l * NR];
+                        }
+                        mem_out[i * n + j] = static_cast<ElementType>(sum);
+                    }
+                }
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsPackedMatrix<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            // the packed panels are read directly, the weight is never unpacked.
+            auto handle1 = oper.template Operand<0>().EvalRegister();
+            auto handle2 = MakeConstEvalHandle(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseFixed
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<TInputHandle1, TInputHandle2, TOutputHandle>;
+        using TData1 = typename TInputHandle1::DataType;
+        using TData2 = typename TInputHandle2::DataType;
+        constexpr static size_t M = TData1::FixedRowNum;
+        constexpr static size_t K = TData1::FixedColNum;
+        constexpr static size_t N = TData2::FixedColNum;
+        static_assert(K == TData2::FixedRowNum, "Shape mismatch for Dot.");
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+            static_assert(IsMatrix<ResType>);
+            ResType out(M, N);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* __restrict mem_in1 = low_in1.RawMemory();
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* __restrict mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* __restrict mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            // all bounds are compile-time constants: a whole output row is accumulated in a
+            // local array the compiler keeps in registers, and the inner loop is fully unrolled.
+            for (size_t i = 0; i < M; ++i)
+            {
+                AccType acc[N] = {};
+                for (size_t k = 0; k < K; ++k)
+                {
+                    const AccType a = mem_in1[i * K + k];
+                    const ElementType* row = mem_in2 + k * N;
+                    for (size_t j = 0; j < N; ++j)
+                    {
+                        acc[j] += a * (AccType)row[j];
+                    }
+                }
+                for (size_t j = 0; j < N; ++j)
+                {
+                    mem_out[i * N + j] = static_cast<ElementType>(acc[j]);
+                }
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsFixedMatrix<TOperand0> || !IsFixedMatrix<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = MakeConstEvalHandle(oper.template Operand<0>());
+            auto handle2 = MakeConstEvalHandle(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseSparse
+{
+    // the transposed product uses its own item type, since eval items are dispatched by type.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool IsTransposed>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TInputHandle1 operand1, TInputHandle2 operand2,
+                 TOutputHandle outputHandle, const TAuxParams&)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {operand1.DataPtr(), operand2.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_operand1(std::move(operand1))
+            , m_operand2(std::move(operand2))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_operand1;
+        const TInputHandle2 m_operand2;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, false>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, false>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+            static_assert(IsMatrix<ResType>);
+
+            const size_t m = in1.Shape().RowNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(in1.Shape().ColNum() == in2.Shape().RowNum());
+            ResType out(m, n);
+
+            auto low_in1 = LowerAccess(in1);
+            const size_t* rowPtr = low_in1.RowPtr();
+            const size_t* colIdx = low_in1.ColIdx();
+            const ElementType* value = low_in1.RawMemory();
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            // out(i, :) = sum of value * in2(col, :) over the non-zero elements of row i.
+            std::vector<AccType> acc(n);
+            for (size_t i = 0; i < m; ++i)
+            {
+                std::fill(acc.begin(), acc.end(), AccType{});
+                for (size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                {
+                    const AccType v = value[p];
+                    const ElementType* row = mem_in2 + colIdx[p] * n;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        acc[j] += v * (AccType)row[j];
+                    }
+                }
+                for (size_t j = 0; j < n; ++j)
+                {
+                    mem_out[j] = static_cast<ElementType>(acc[j]);
+                }
+                mem_out += n;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroupTrans : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, true>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, true>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+            static_assert(IsMatrix<ResType>);
+
+            const size_t m = in1.Shape().RowNum();
+            const size_t k = in1.Shape().ColNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(m == in2.Shape().RowNum());
+            ResType out(k, n);
+
+            auto low_in1 = LowerAccess(in1);
+            const size_t* rowPtr = low_in1.RowPtr();
+            const size_t* colIdx = low_in1.ColIdx();
+            const ElementType* value = low_in1.RawMemory();
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            // transpose(in1) * in2: scatter value * in2(i, :) to out(col, :).
+            // the rows of out are hit in any order, so they are all accumulated before the store.
+            std::vector<AccType> acc(k * n, AccType{});
+            for (size_t i = 0; i < m; ++i)
+            {
+                const ElementType* row = mem_in2 + i * n;
+                for (size_t p = rowPtr[i]; p < rowPtr[i + 1]; ++p)
+                {
+                    const AccType v = value[p];
+                    AccType* aim = acc.data() + colIdx[p] * n;
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        aim[j] += v * (AccType)row[j];
+                    }
+                }
+            }
+            std::transform(acc.begin(), acc.end(), mem_out,
+                           [](AccType v) { return static_cast<ElementType>(v); });
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename T>
+    constexpr bool IsTransposedCsr = false;
+
+    template <typename TCsr>
+    constexpr bool IsTransposedCsr<Operator<OpTags::Transpose, TCsr>> = IsCsrMatrix<TCsr>;
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        if constexpr (!IsCsrMatrix<TOperand0> && !IsTransposedCsr<TOperand0>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = [&oper]()
+            {
+                if constexpr (IsCsrMatrix<TOperand0>)
+                {
+                    return MakeConstEvalHandle(oper.template Operand<0>());
+                }
+                else
+                {
+                    return MakeConstEvalHandle(oper.template Operand<0>().template Operand<0>());
+                }
+            }();
+            auto handle2 = oper.template Operand<1>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            constexpr bool isTransposed = IsTransposedCsr<TOperand0>;
+            using ItemType = EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle), isTransposed>;
+            using GroupType = std::conditional_t<!isTransposed,
+                                                 EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>,
+                                                 EvalGroupTrans<decltype(handle1), decltype(handle2), decltype(outHandle)>>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseOneHot
+{
+    // gather and scatter use different item types, since eval items are dispatched by type.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool IsScatter>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TInputHandle1 operand1, TInputHandle2 operand2,
+                 TOutputHandle outputHandle, const TAuxParams&)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {operand1.DataPtr(), operand2.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_operand1(std::move(operand1))
+            , m_operand2(std::move(operand2))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_operand1;
+        const TInputHandle2 m_operand2;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TOneHot>
+    size_t BatchNum(const TOneHot& data)
+    {
+        if constexpr (IsMatrix<TOneHot>)
+        {
+            return (size_t)1;
+        }
+        else
+        {
+            return data.Shape().BatchNum();
+        }
+    }
+
+    template <typename TOneHot>
+    size_t HotPos(const TOneHot& data, size_t batchId)
+    {
+        if constexpr (IsMatrix<TOneHot>)
+        {
+            return data.HotPos();
+        }
+        else
+        {
+            return data.HotPos(batchId);
+        }
+    }
+
+    template <typename TResType>
+    TResType CreateResult(size_t batchNum, size_t rowNum, size_t colNum)
+    {
+        if constexpr (IsMatrix<TResType>)
+        {
+            assert(batchNum == 1);
+            return TResType(rowNum, colNum);
+        }
+        else
+        {
+            return TResType(batchNum, rowNum, colNum);
+        }
+    }
+
+    // one-hot(hot) * in2 is row hot of in2: a (batch of) 1 * n result copied without touching other rows.
+    // in2 is a single matrix when the batch operand was duplicated from it.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, false>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, false>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+
+            const size_t batchNum = BatchNum(in1);
+            const size_t k = in2.Shape().RowNum();
+            const size_t n = in2.Shape().ColNum();
+            const size_t in2Stride = IsMatrix<RemConstRef<decltype(in2)>> ? 0 : k * n;
+            ResType out = CreateResult<ResType>(batchNum, 1, n);
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            for (size_t b = 0; b < batchNum; ++b)
+            {
+                const size_t hot = HotPos(in1, b);
+                assert(hot < k);
+                std::copy(mem_in2 + hot * n, mem_in2 + (hot + 1) * n, mem_out);
+                mem_in2 += in2Stride;
+                mem_out += n;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    // transpose(one-hot(hot)) * in2 is zero except row hot, which equals in2.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroupScatter : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, true>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, true>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+
+            const size_t batchNum = BatchNum(in1);
+            const size_t m = in1.Shape().ColNum();
+            const size_t n = in2.Shape().ColNum();
+            assert(in2.Shape().RowNum() == 1);
+            ResType out = CreateResult<ResType>(batchNum, m, n);
+
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::fill(mem_out, mem_out + batchNum * m * n, ElementType{});
+            for (size_t b = 0; b < batchNum; ++b)
+            {
+                std::copy(mem_in2, mem_in2 + n, mem_out + HotPos(in1, b) * n);
+                mem_in2 += n;
+                mem_out += m * n;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename T>
+    constexpr bool IsTransposedOneHot = false;
+
+    template <typename TOneHot>
+    constexpr bool IsTransposedOneHot<Operator<OpTags::Transpose, TOneHot>> = IsOneHot<TOneHot>;
+
+    template <typename T>
+    constexpr bool IsDuplicatedMatrix = false;
+
+    template <typename TOriData>
+    constexpr bool IsDuplicatedMatrix<Operator<OpTags::Duplicate, TOriData, Shape<CategoryTags::BatchMatrix>>> = IsMatrix<TOriData>;
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsOneHot<TOperand0> && !IsTransposedOneHot<TOperand0>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            constexpr bool isScatter = IsTransposedOneHot<TOperand0>;
+            auto handle1 = [&oper]()
+            {
+                if constexpr (!isScatter)
+                {
+                    return MakeConstEvalHandle(oper.template Operand<0>());
+                }
+                else
+                {
+                    return MakeConstEvalHandle(oper.template Operand<0>().template Operand<0>());
+                }
+            }();
+            // the gather reads the duplicated matrix directly instead of its batch copies.
+            auto handle2 = [&oper]()
+            {
+                if constexpr (!isScatter && IsDuplicatedMatrix<TOperand1>)
+                {
+                    return oper.template Operand<1>().Operand().EvalRegister();
+                }
+                else
+                {
+                    return oper.template Operand<1>().EvalRegister();
+                }
+            }();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle), isScatter>;
+            using GroupType = std::conditional_t<!isScatter,
+                                                 EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>,
+                                                 EvalGroupScatter<decltype(handle1), decltype(handle2), decltype(outHandle)>>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseShared
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool SharedLeft>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ResType = typename TOutputHandle::DataType;
+    public:
+        EvalItem(TInputHandle1 operand1, TInputHandle2 operand2,
+                 MetaNN::Shape<typename ResType::CategoryTag> p_outShape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {operand1.DataPtr(), operand2.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_operand1(std::move(operand1))
+            , m_operand2(std::move(operand2))
+            , m_outShape(std::move(p_outShape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_operand1;
+        const TInputHandle2 m_operand2;
+        const MetaNN::Shape<typename ResType::CategoryTag> m_outShape;
+        TOutputHandle m_outputHandle;
+    };
+
+    // One operand is a single matrix shared by all products. A shared right operand turns
+    // the batch into one tall product, a shared left operand is read by every product in place.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool SharedLeft>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, SharedLeft>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, SharedLeft>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_outShape);
+
+            const size_t m = out.Shape().RowNum();
+            const size_t k = in1.Shape().ColNum();
+            const size_t n = out.Shape().ColNum();
+            assert(k == in2.Shape().RowNum());
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            if constexpr (SharedLeft)
+            {
+                const size_t loopCount = (m * n == 0) ? 0 : out.Shape().Count() / (m * n);
+                NSGemm::GemmBatch(false, false, loopCount, m, n, k,
+                                  mem_in1, 0, mem_in2, k * n, mem_out, m * n);
+            }
+            else
+            {
+                const size_t rowNum = (n == 0) ? 0 : out.Shape().Count() / n;
+                NSGemm::Gemm(false, false, rowNum, n, k, mem_in1, k, mem_in2, n, mem_out, n);
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename T>
+    constexpr bool IsSharedMatrix = false;
+
+    template <typename TOriData, typename TCategory>
+    constexpr bool IsSharedMatrix<Operator<OpTags::Duplicate, TOriData, Shape<TCategory>>> = IsMatrix<TOriData>;
+
+/// Batched Dot where one operand is a Duplicate of a matrix (e.g. a weight applied to every
+/// sample): the matrix is read once instead of being copied for each product.
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        using ElementType = typename TEvalRes::DataType::ElementType;
+        if constexpr ((!IsSharedMatrix<TOperand0> && !IsSharedMatrix<TOperand1>) ||
+                      !NSGemm::IsSupported<ElementType>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            constexpr bool sharedLeft = !IsSharedMatrix<TOperand1>;
+            auto handle1 = [&oper]()
+            {
+                if constexpr (sharedLeft)
+                {
+                    return oper.template Operand<0>().Operand().EvalRegister();
+                }
+                else
+                {
+                    return oper.template Operand<0>().EvalRegister();
+                }
+            }();
+            auto handle2 = [&oper]()
+            {
+                if constexpr (sharedLeft)
+                {
+                    return oper.template Operand<1>().EvalRegister();
+                }
+                else
+                {
+                    return oper.template Operand<1>().Operand().EvalRegister();
+                }
+            }();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle), sharedLeft>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle), sharedLeft>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   oper.Shape(), std::move(outHandle));
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseTransposed
+{
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool TransLeft, bool TransRight>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ResType = typename TOutputHandle::DataType;
+    public:
+        EvalItem(TInputHandle1 operand1, TInputHandle2 operand2,
+                 MetaNN::Shape<typename ResType::CategoryTag> p_outShape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {operand1.DataPtr(), operand2.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_operand1(std::move(operand1))
+            , m_operand2(std::move(operand2))
+            , m_outShape(std::move(p_outShape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_operand1;
+        const TInputHandle2 m_operand2;
+        const MetaNN::Shape<typename ResType::CategoryTag> m_outShape;
+        TOutputHandle m_outputHandle;
+    };
+
+    // The operands hold the matrices before transposition; the GEMM reads them transposed.
+    template <typename TInputHandle1, typename TInputHandle2, typename TOutputHandle, bool TransLeft, bool TransRight>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, TransLeft, TransRight>>
+    {
+        using EvalItemType = EvalItem<TInputHandle1, TInputHandle2, TOutputHandle, TransLeft, TransRight>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_operand1.Data();
+            const auto& in2 = evalItem.m_operand2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_outShape);
+
+            const size_t m = out.Shape().RowNum();
+            const size_t n = out.Shape().ColNum();
+            const size_t k = TransLeft ? in1.Shape().RowNum() : in1.Shape().ColNum();
+            assert(m == (TransLeft ? in1.Shape().ColNum() : in1.Shape().RowNum()));
+            assert(k == (TransRight ? in2.Shape().ColNum() : in2.Shape().RowNum()));
+            assert(n == (TransRight ? in2.Shape().RowNum() : in2.Shape().ColNum()));
+
+            const size_t loopCount = (m * n == 0) ? 0 : out.Shape().Count() / (m * n);
+            assert(in1.Shape().Count() == loopCount * m * k);
+            assert(in2.Shape().Count() == loopCount * k * n);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            NSGemm::GemmBatch(TransLeft, TransRight, loopCount, m, n, k,
+                              mem_in1, m * k, mem_in2, k * n, mem_out, m * n);
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename T>
+    constexpr bool IsTransposed = false;
+
+    template <typename TOriData>
+    constexpr bool IsTransposed<Operator<OpTags::Transpose, TOriData>> = true;
+
+    template <typename TOperand>
+    auto EvalUntransposed(const TOperand& operand)
+    {
+        if constexpr (IsTransposed<TOperand>)
+        {
+            return operand.template Operand<0>().EvalRegister();
+        }
+        else
+        {
+            return operand.EvalRegister();
+        }
+    }
+
+/// Dot with a Transpose operand (e.g. the gradients in DotLayer::FeedBackward): the
+/// operand under Transpose is evaluated and read transposed by the GEMM, so the
+/// transposed copy is never built.
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        using ElementType = typename TEvalRes::DataType::ElementType;
+        if constexpr ((!IsTransposed<TOperand0> && !IsTransposed<TOperand1>) ||
+                      !NSGemm::IsSupported<ElementType>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            constexpr bool transLeft = IsTransposed<TOperand0>;
+            constexpr bool transRight = IsTransposed<TOperand1>;
+            auto handle1 = EvalUntransposed(oper.template Operand<0>());
+            auto handle2 = EvalUntransposed(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle), transLeft, transRight>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle), transLeft, transRight>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   oper.Shape(), std::move(outHandle));
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+namespace OperDot::NSCaseConstant
+{
+    template <typename TInputHandle, typename TOutputHandle, bool ConstLeft>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ResType = typename TOutputHandle::DataType;
+        using ElementType = typename ResType::ElementType;
+    public:
+        EvalItem(TInputHandle oriHandle, ElementType p_value,
+                 MetaNN::Shape<typename ResType::CategoryTag> p_outShape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {oriHandle.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle(std::move(oriHandle))
+            , m_value(p_value)
+            , m_outShape(std::move(p_outShape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle m_inputHandle;
+        const ElementType m_value;
+        const MetaNN::Shape<typename ResType::CategoryTag> m_outShape;
+        TOutputHandle m_outputHandle;
+    };
+
+    // x * C with every element of C equal to c: each output row is c * (sum of the x row).
+    template <typename TInputHandle, typename TOutputHandle>
+    class EvalGroupRight : public TrivalEvalGroup<EvalItem<TInputHandle, TOutputHandle, false>>
+    {
+        using EvalItemType = EvalItem<TInputHandle, TOutputHandle, false>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+            ResType out(evalItem.m_outShape);
+
+            const size_t k = in.Shape().ColNum();
+            const size_t n = out.Shape().ColNum();
+            const size_t rowNum = (n == 0) ? 0 : out.Shape().Count() / n;
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                AccType sum{};
+                for (size_t j = 0; j < k; ++j)
+                {
+                    sum += (AccType)mem_in[j];
+                }
+                std::fill(mem_out, mem_out + n, static_cast<ElementType>((AccType)evalItem.m_value * sum));
+                mem_in += k;
+                mem_out += n;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    // C * x with every element of C equal to c: each output row is c * (column sums of x).
+    template <typename TInputHandle, typename TOutputHandle>
+    class EvalGroupLeft : public TrivalEvalGroup<EvalItem<TInputHandle, TOutputHandle, true>>
+    {
+        using EvalItemType = EvalItem<TInputHandle, TOutputHandle, true>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+            ResType out(evalItem.m_outShape);
+
+            const size_t k = in.Shape().RowNum();
+            const size_t n = in.Shape().ColNum();
+            const size_t m = out.Shape().RowNum();
+            const size_t sampleNum = (m * n == 0) ? 0 : out.Shape().Count() / (m * n);
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::vector<AccType> colSum(n);
+            std::vector<ElementType> outRow(n);
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                std::fill(colSum.begin(), colSum.end(), AccType{});
+                for (size_t i = 0; i < k; ++i)
+                {
+                    for (size_t j = 0; j < n; ++j)
+                    {
+                        colSum[j] += (AccType)mem_in[j];
+                    }
+                    mem_in += n;
+                }
+                for (size_t j = 0; j < n; ++j)
+                {
+                    outRow[j] = static_cast<ElementType>((AccType)evalItem.m_value * colSum[j]);
+                }
+                for (size_t i = 0; i < m; ++i)
+                {
+                    std::copy(outRow.begin(), outRow.end(), mem_out);
+                    mem_out += n;
+                }
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+/// Dot with exactly one constant operand (TrivalMatrix, ZeroData): reduces the other
+/// operand to row or column sums and scales them, the constant is never materialised.
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (IsConstantOperand<TOperand0> == IsConstantOperand<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            constexpr bool constLeft = IsConstantOperand<TOperand0>;
+            const auto& constOperand = oper.template Operand<constLeft ? 0 : 1>();
+            auto handle = oper.template Operand<constLeft ? 1 : 0>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<decltype(handle), decltype(outHandle), constLeft>;
+            using GroupType = std::conditional_t<constLeft,
+                                                 EvalGroupLeft<decltype(handle), decltype(outHandle)>,
+                                                 EvalGroupRight<decltype(handle), decltype(outHandle)>>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle), ConstantOperandValue(constOperand),
+                                                   oper.Shape(), std::move(outHandle));
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
 }
 
 template <typename TOperand1, typename TOperand2>
@@ -127,7 +1348,16 @@ private:
 template <>
 struct OperSeq_<OpTags::Dot>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperDot::NSCaseGen::EvalItem, OperDot::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<OperDot::NSCaseConstant::Calculator,
+                                  OperDot::NSCaseOneHot::Calculator,
+                                  OperDot::NSCaseSparse::Calculator,
+                                  OperDot::NSCaseQuantized::Calculator,
+                                  OperDot::NSCasePacked::Calculator,
+                                  OperDot::NSCaseFixed::Calculator,
+                                  OperDot::NSCaseStrided::Calculator,
+                                  OperDot::NSCaseTransposed::Calculator,
+                                  OperDot::NSCaseShared::Calculator,
+                                  TailCalculator<OperDot::NSCaseGen::EvalItem, OperDot::NSCaseGen::EvalGroup>>;
 };
 
 template <typename TP1, typename TP2,
@@ -0,0 +1,366 @@
+#pragma once
+
+#include <MetaNN/facilities/simd.h>
+#include <MetaNN/facilities/thread_pool.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MetaNN::NSGemm
+{
+    template <typename TElem>
+    constexpr bool IsSupported = std::is_same_v<TElem, float> || std::is_same_v<TElem, double>;
+
+    // MR x NR is the register block computed by the micro-kernel, A is packed in MC x KC blocks
+    // (kept in L2) and B in KC x NC blocks whose NR-wide panels stay in L1 during the kernel.
+    template <typename TElem>
+    struct BlockConfig
+    {
+        constexpr static size_t MR = 6;
+        constexpr static size_t NR = 64 / sizeof(TElem);
+        constexpr static size_t KC = 256;
+        constexpr static size_t MC = 120;
+        constexpr static size_t NC = 4096;
+    };
+
+    // Products below this number of multiply-adds run on the calling thread only.
+    constexpr size_t ParallelThreshold = 64 * 64 * 64;
+
+#if defined(__GNUC__) || defined(__clang__)
+    // acc (MR x NR, row-major) = A panel (kc x MR) * B panel (kc x NR), computed on
+    // Bytes-wide vectors. Inlined into each dispatch variant so every target gets its own code.
+    template <typename TElem, size_t Bytes>
+    __attribute__((always_inline)) inline
+    void KernelBody(size_t kc, const TElem* __restrict a, const TElem* __restrict b, TElem* __restrict acc)
+    {
+        using Config = BlockConfig<TElem>;
+        using TVec = SimdVec<TElem, Bytes>;
+        constexpr size_t Lanes = Bytes / sizeof(TElem);
+        constexpr size_t NV = Config::NR / Lanes;
+        static_assert(NV * Lanes == Config::NR);
+
+        TVec c[Config::MR][NV] = {};
+        for (size_t p = 0; p < kc; ++p)
+        {
+            TVec bv[NV];
+            std::memcpy(bv, b, sizeof(bv));
+            for (size_t i = 0; i < Config::MR; ++i)
+            {
+                const TElem ai = a[i];
+                for (size_t v = 0; v < NV; ++v)
+                {
+                    c[i][v] += ai * bv[v];
+                }
+            }
+            a += Config::MR;
+            b += Config::NR;
+        }
+        std::memcpy(acc, c, sizeof(c));
+    }
+
+    template <typename TElem>
+    void KernelGeneric(size_t kc, const TElem* a, const TElem* b, TElem* acc)
+    {
+        KernelBody<TElem, 16>(kc, a, b, acc);
+    }
+#else
+    template <typename TElem>
+    void KernelGeneric(size_t kc, const TElem* __restrict a, const TElem* __restrict b, TElem* __restrict acc)
+    {
+        using Config = BlockConfig<TElem>;
+        TElem c[Config::MR][Config::NR] = {};
+        for (size_t p = 0; p < kc; ++p)
+        {
+            for (size_t i = 0; i < Config::MR; ++i)
+            {
+                const TElem ai = a[i];
+                for (size_t j = 0; j < Config::NR; ++j)
+                {
+                    c[i][j] += ai * b[j];
+                }
+            }
+            a += Config::MR;
+            b += Config::NR;
+        }
+        std::memcpy(acc, c, sizeof(c));
+    }
+#endif
+
+#ifdef METANN_X86_DISPATCH
+    template <typename TElem>
+    __attribute__((target("avx2,fma")))
+    void KernelAvx2(size_t kc, const TElem* a, const TElem* b, TElem* acc)
+    {
+        KernelBody<TElem, 32>(kc, a, b, acc);
+    }
+
+    template <typename TElem>
+    __attribute__((target("avx512f")))
+    void KernelAvx512(size_t kc, const TElem* a, const TElem* b, TElem* acc)
+    {
+        KernelBody<TElem, 64>(kc, a, b, acc);
+    }
+#endif
+
+    template <typename TElem>
+    using KernelType = void(*)(size_t, const TElem*, const TElem*, TElem*);
+
+    // The micro-kernel for the running CPU, selected once.
+    template <typename TElem>
+    KernelType<TElem> SelectKernel()
+    {
+#ifdef METANN_X86_DISPATCH
+        switch (CpuSimdLevel())
+        {
+        case SimdLevel::Avx512:
+            return &KernelAvx512<TElem>;
+        case SimdLevel::Avx2:
+            return &KernelAvx2<TElem>;
+        default:
+            break;
+        }
+#endif
+        return &KernelGeneric<TElem>;
+    }
+
+    template <typename TElem>
+    KernelType<TElem> Kernel()
+    {
+        static const KernelType<TElem> kernel = SelectKernel<TElem>();
+        return kernel;
+    }
+
+    // Packs rows [0, mc) and columns [0, kc) of op(A) into MR-row panels: panel r holds
+    // kc groups of MR elements, rows past mc are zero.
+    template <typename TElem>
+    void PackA(bool trans, const TElem* a, size_t lda, size_t mc, size_t kc, TElem* out)
+    {
+        constexpr size_t MR = BlockConfig<TElem>::MR;
+        for (size_t ir = 0; ir < mc; ir += MR)
+        {
+            const size_t mr = std::min(MR, mc - ir);
+            for (size_t p = 0; p < kc; ++p)
+            {
+                for (size_t i = 0; i < mr; ++i)
+                {
+                    out[i] = trans ? a[p * lda + ir + i] : a[(ir + i) * lda + p];
+                }
+                std::fill(out + mr, out + MR, TElem{});
+                out += MR;
+            }
+        }
+    }
+
+    // Packs rows [0, kc) and columns [0, nc) of op(B) into NR-column panels, zero padded.
+    template <typename TElem>
+    void PackB(bool trans, const TElem* b, size_t ldb, size_t kc, size_t nc, TElem* out)
+    {
+        constexpr size_t NR = BlockConfig<TElem>::NR;
+        for (size_t jr = 0; jr < nc; jr += NR)
+        {
+            const size_t nr = std::min(NR, nc - jr);
+            for (size_t p = 0; p < kc; ++p)
+            {
+                if (trans)
+                {
+                    for (size_t j = 0; j < nr; ++j)
+                    {
+                        out[j] = b[(jr + j) * ldb + p];
+                    }
+                }
+                else
+                {
+                    std::copy(b + p * ldb + jr, b + p * ldb + jr + nr, out);
+                }
+                std::fill(out + nr, out + NR, TElem{});
+                out += NR;
+            }
+        }
+    }
+
+    /// Width of the B panels, and of the column panels of PackedMatrix, for TElem.
+    template <typename TElem>
+    constexpr size_t PanelWidth = IsSupported<TElem> ? BlockConfig<TElem>::NR : 8;
+
+    // C = op(A) * B, where prepareB(jc, nc, pc, kc) makes rows [pc, pc + kc) and columns
+    // [jc, jc + nc) of B available as NR-wide panels of kc rows and returns the first panel
+    // and the distance between two panels.
+    template <typename TElem, typename TPrepareB>
+    void GemmPanels(bool transA, size_t m, size_t n, size_t k, const TElem* a, size_t lda,
+                    TPrepareB&& prepareB, TElem* c, size_t ldc, bool parallel)
+    {
+        static_assert(IsSupported<TElem>);
+        using Config = BlockConfig<TElem>;
+        constexpr size_t MR = Config::MR;
+        constexpr size_t NR = Config::NR;
+
+        if ((m == 0) || (n == 0))
+        {
+            return;
+        }
+        if (k == 0)
+        {
+            for (size_t i = 0; i < m; ++i)
+            {
+                std::fill(c + i * ldc, c + i * ldc + n, TElem{});
+            }
+            return;
+        }
+
+        const KernelType<TElem> kernel = Kernel<TElem>();
+        const bool useThreads = parallel && (m * n * k >= ParallelThreshold) &&
+                                (ThreadPool::Inst().ThreadNum() > 1);
+
+        for (size_t jc = 0; jc < n; jc += Config::NC)
+        {
+            const size_t nc = std::min(Config::NC, n - jc);
+            const size_t panelNum = (nc + NR - 1) / NR;
+            for (size_t pc = 0; pc < k; pc += Config::KC)
+            {
+                const size_t kc = std::min(Config::KC, k - pc);
+                const auto preparedB = prepareB(jc, nc, pc, kc);
+                const TElem* bPanels = preparedB.first;
+                const size_t panelStride = preparedB.second;
+
+                // a task is an MC row block times a group of B panels; narrow products get
+                // more groups so that all threads find work.
+                const size_t rowBlockNum = (m + Config::MC - 1) / Config::MC;
+                size_t groupNum = 1;
+                if (useThreads)
+                {
+                    const size_t threadNum = ThreadPool::Inst().ThreadNum();
+                    groupNum = std::min(panelNum, (threadNum + rowBlockNum - 1) / rowBlockNum);
+                }
+                const size_t panelPerGroup = (panelNum + groupNum - 1) / groupNum;
+                groupNum = (panelNum + panelPerGroup - 1) / panelPerGroup;
+
+                auto task = [&](size_t taskId)
+                {
+                    const size_t ic = (taskId / groupNum) * Config::MC;
+                    const size_t panelBeg = (taskId % groupNum) * panelPerGroup;
+                    const size_t panelEnd = std::min(panelNum, panelBeg + panelPerGroup);
+                    const size_t mc = std::min(Config::MC, m - ic);
+
+                    thread_local std::vector<TElem> packedA;
+                    packedA.resize(((mc + MR - 1) / MR) * MR * kc);
+                    PackA(transA, transA ? a + pc * lda + ic : a + ic * lda + pc, lda, mc, kc, packedA.data());
+
+                    TElem acc[MR * NR];
+                    for (size_t panel = panelBeg; panel < panelEnd; ++panel)
+                    {
+                        const size_t jr = panel * NR;
+                        const size_t nr = std::min(NR, nc - jr);
+                        const TElem* bPanel = bPanels + panel * panelStride;
+                        for (size_t ir = 0; ir < mc; ir += MR)
+                        {
+                            const size_t mr = std::min(MR, mc - ir);
+                            kernel(kc, packedA.data() + ir * kc, bPanel, acc);
+
+                            TElem* cBlock = c + (ic + ir) * ldc + jc + jr;
+                            for (size_t i = 0; i < mr; ++i)
+                            {
+                                TElem* cRow = cBlock + i * ldc;
+                                const TElem* accRow = acc + i * NR;
+                                if (pc == 0)
+                                {
+                                    std::copy(accRow, accRow + nr, cRow);
+                                }
+                                else
+                                {
+                                    for (size_t j = 0; j < nr; ++j)
+                                    {
+                                        cRow[j] += accRow[j];
+                                    }
+                                }
+                            }
+                        }
+                    }
+                };
+
+                const size_t taskNum = rowBlockNum * groupNum;
+                if (useThreads)
+                {
+                    ThreadPool::Inst().ParallelFor(taskNum, task);
+                }
+                else
+                {
+                    for (size_t i = 0; i < taskNum; ++i)
+                    {
+                        task(i);
+                    }
+                }
+            }
+        }
+    }
+
+    /// C (m x n, row stride ldc) = op(A) * op(B), where op(A) is m x k and op(B) is k x n.
+    /// With transA, A is stored k x m (row stride lda) and read transposed; likewise transB.
+    /// Large products are split over output tiles on ThreadPool.
+    template <typename TElem>
+    void Gemm(bool transA, bool transB, size_t m, size_t n, size_t k,
+              const TElem* a, size_t lda, const TElem* b, size_t ldb,
+              TElem* c, size_t ldc, bool parallel = true)
+    {
+        constexpr size_t NR = BlockConfig<TElem>::NR;
+        std::vector<TElem> packedB;
+        auto prepareB = [&](size_t jc, size_t nc, size_t pc, size_t kc)
+        {
+            packedB.resize((nc + NR - 1) / NR * NR * kc);
+            PackB(transB, transB ? b + jc * ldb + pc : b + pc * ldb + jc, ldb, kc, nc, packedB.data());
+            return std::make_pair((const TElem*)packedB.data(), NR * kc);
+        };
+        GemmPanels(transA, m, n, k, a, lda, prepareB, c, ldc, parallel);
+    }
+
+    /// C (m x n, row stride ldc) = op(A) * B, where B (k x n) is already stored as PanelWidth-wide
+    /// column panels of all k rows, zero padded (the layout of PackedMatrix). The panels are
+    /// read in place, so B is never packed again.
+    template <typename TElem>
+    void GemmPackedB(bool transA, size_t m, size_t n, size_t k, const TElem* a, size_t lda,
+                     const TElem* packedB, TElem* c, size_t ldc, bool parallel = true)
+    {
+        constexpr size_t NR = BlockConfig<TElem>::NR;
+        auto prepareB = [packedB, k](size_t jc, size_t, size_t pc, size_t)
+        {
+            return std::make_pair(packedB + ((jc / NR) * k + pc) * NR, NR * k);
+        };
+        GemmPanels(transA, m, n, k, a, lda, prepareB, c, ldc, parallel);
+    }
+
+    /// loopCount independent products C_l = op(A_l) * op(B_l) of compact matrices, where
+    /// A_l = a + l * strideA and so on. A stride of 0 shares that operand across the batch.
+    /// Many or small products are distributed over ThreadPool one product per task, while a
+    /// few large products run one after another, each split over output tiles.
+    template <typename TElem>
+    void GemmBatch(bool transA, bool transB, size_t loopCount, size_t m, size_t n, size_t k,
+                   const TElem* a, size_t strideA, const TElem* b, size_t strideB,
+                   TElem* c, size_t strideC)
+    {
+        const size_t lda = transA ? m : k;
+        const size_t ldb = transB ? k : n;
+        const size_t threadNum = ThreadPool::Inst().ThreadNum();
+        const size_t work = m * n * k;
+        const bool byProduct = (loopCount > 1) && (threadNum > 1) &&
+                               (loopCount * work >= ParallelThreshold) &&
+                               ((loopCount >= threadNum) || (work < ParallelThreshold));
+
+        auto product = [&](size_t l, bool parallel)
+        {
+            Gemm(transA, transB, m, n, k, a + l * strideA, lda, b + l * strideB, ldb,
+                 c + l * strideC, n, parallel);
+        };
+        if (byProduct)
+        {
+            ThreadPool::Inst().ParallelFor(loopCount, [&product](size_t l) { product(l, false); });
+        }
+        else
+        {
+            for (size_t l = 0; l < loopCount; ++l)
+            {
+                product(l, true);
+            }
+        }
+    }
+}
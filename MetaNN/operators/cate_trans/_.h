@@ -2,4 +2,5 @@
 
 #include <MetaNN/operators/cate_trans/slice.h>
 #include <MetaNN/operators/cate_trans/collapse.h>
-#include <MetaNN/operators/cate_trans/duplicate.h>
\ No newline at end of file
+#include <MetaNN/operators/cate_trans/duplicate.h>
+#include <MetaNN/operators/cate_trans/reshape.h>
\ No newline at end of file
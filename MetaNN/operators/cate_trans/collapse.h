@@ -1,17 +1,22 @@
 #pragma once
 
+#include <MetaNN/data/batch/batch_one_hot_vector.h>
+#include <MetaNN/data/cardinal/matrix/matrix_view.h>
+#include <MetaNN/data/facilities/low_precision.h>
 #include <MetaNN/data/facilities/shape.h>
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/cate_trans/facilities/bucket_sum.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <cassert>
-#include <cstring>
 #include <type_traits>
 #include <utility>
 
 namespace MetaNN::OpTags
 {
     struct Collapse;
+    struct Dot;
+    struct Transpose;
 }
 
 namespace MetaNN
@@ -100,17 +105,100 @@ bool ShapeMatch(const TOriShape& ori, const Shape<CategoryTags::ThreeDArray>& ai
 
             assert(inCount % outCount == 0);
 
-            // copy the first bucket for initialization, accumulate the other parts.
-            const size_t loopCount = inCount / outCount;
-            memcpy(mem_out, mem_in, sizeof(ElementType) * outCount);
-            mem_in += outCount;
-            for (size_t i = 1; i < loopCount; ++i)
+            if constexpr (IsMatrixView<RemConstRef<decltype(in)>>)
             {
-                for (size_t j = 0; j < outCount; ++j)
+                // a strided view can only be reduced to a scalar: sum it row by row.
+                assert(outCount == 1);
+                const size_t rowNum = in.Shape().RowNum();
+                const size_t colNum = in.Shape().ColNum();
+                const size_t rowLen = low_in.RowLen();
+                ComputeType<ElementType> sum{};
+                for (size_t i = 0; i < rowNum; ++i)
                 {
-                    mem_out[j] += mem_in[j];
+                    for (size_t j = 0; j < colNum; ++j)
+                    {
+                        sum += mem_in[j];
+                    }
+                    mem_in += rowLen;
                 }
-                mem_in += outCount;
+                mem_out[0] = static_cast<ElementType>(sum);
+                evalItem.m_outputHandle.SetData(std::move(out));
+                return;
+            }
+
+            NSBucketSum::BucketSum(mem_in, inCount / outCount, outCount, mem_out);
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    // Collapse(Dot(Transpose(batch one-hot), grad)) to a matrix: the gradient of an embedding lookup.
+    // Each batch only contributes to one row, so the rows of grad are scatter-added directly.
+    template <typename T>
+    constexpr bool IsOneHotGrad = false;
+
+    template <typename TElem, typename TDevice, typename TGrad>
+    constexpr bool IsOneHotGrad<Operator<OpTags::Dot,
+                                         Operator<OpTags::Transpose, BatchOneHotVector<TElem, TDevice>>,
+                                         TGrad>> = true;
+
+    template <typename TOneHotHandle, typename TGradHandle, typename TOutputHandle>
+    class OneHotGradEvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        OneHotGradEvalItem(TOneHotHandle oneHotHandle, TGradHandle gradHandle,
+                           Shape<CategoryTags::Matrix> shape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(OneHotGradEvalItem)),
+                       {oneHotHandle.DataPtr(), gradHandle.DataPtr()}, outputHandle.DataPtr())
+            , m_oneHotHandle(std::move(oneHotHandle))
+            , m_gradHandle(std::move(gradHandle))
+            , m_shape(std::move(shape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TOneHotHandle m_oneHotHandle;
+        const TGradHandle m_gradHandle;
+        const Shape<CategoryTags::Matrix> m_shape;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TOneHotHandle, typename TGradHandle, typename TOutputHandle>
+    class OneHotGradEvalGroup : public TrivalEvalGroup<OneHotGradEvalItem<TOneHotHandle, TGradHandle, TOutputHandle>>
+    {
+        using EvalItemType = OneHotGradEvalItem<TOneHotHandle, TGradHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& oneHot = evalItem.m_oneHotHandle.Data();
+            const auto& grad = evalItem.m_gradHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_shape);
+
+            const size_t batchNum = oneHot.Shape().BatchNum();
+            const size_t colNum = out.Shape().ColNum();
+            assert(grad.Shape().RowNum() == 1);
+            assert(grad.Shape().ColNum() == colNum);
+
+            auto low_grad = LowerAccess(grad);
+            const ElementType* mem_grad = low_grad.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<typename EvalItemType::DeviceType, DeviceTags::CPU>,
+                          "Currently only CPU is supported");
+
+            std::fill(mem_out, mem_out + out.Shape().Count(), ElementType{});
+            for (size_t b = 0; b < batchNum; ++b)
+            {
+                ElementType* aim = mem_out + oneHot.HotPos(b) * colNum;
+                for (size_t j = 0; j < colNum; ++j)
+                {
+                    aim[j] += mem_grad[j];
+                }
+                mem_grad += colNum;
             }
             evalItem.m_outputHandle.SetData(std::move(out));
         }
@@ -123,15 +211,32 @@ struct Calculator
     {
         using DeviceType = typename TEvalRes::DataType::DeviceType;
 
-        auto handle = oriData.EvalRegister();
-        auto outHandle = evalRes.Handle();
-        
-        using ItemType = EvalItem<decltype(handle), TShape, decltype(outHandle)>;
-        using GroupType = EvalGroup<decltype(handle), TShape, decltype(outHandle)>;
-        using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+        if constexpr (IsOneHotGrad<TOriData> && std::is_same_v<TShape, Shape<CategoryTags::Matrix>>)
+        {
+            auto oneHotHandle = MakeConstEvalHandle(oriData.template Operand<0>().template Operand<0>());
+            auto gradHandle = oriData.template Operand<1>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+
+            using ItemType = OneHotGradEvalItem<decltype(oneHotHandle), decltype(gradHandle), decltype(outHandle)>;
+            using GroupType = OneHotGradEvalGroup<decltype(oneHotHandle), decltype(gradHandle), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
 
-        auto item = std::make_unique<ItemType>(std::move(handle), shape, std::move(outHandle));
-        EvalPlan<DeviceType>::Inst().template Register<DispatcherType>(std::move(item));
+            auto item = std::make_unique<ItemType>(std::move(oneHotHandle), std::move(gradHandle),
+                                                   shape, std::move(outHandle));
+            EvalPlan<DeviceType>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+        else
+        {
+            auto handle = StridedEvalRegister(oriData);
+            auto outHandle = evalRes.Handle();
+
+            using ItemType = EvalItem<decltype(handle), TShape, decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle), TShape, decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle), shape, std::move(outHandle));
+            EvalPlan<DeviceType>::Inst().template Register<DispatcherType>(std::move(item));
+        }
     }
 };
 }
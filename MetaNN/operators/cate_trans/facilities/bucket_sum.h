@@ -0,0 +1,236 @@
+#pragma once
+
+#include <MetaNN/data/facilities/low_precision.h>
+#include <MetaNN/facilities/simd.h>
+#include <MetaNN/facilities/thread_pool.h>
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+// Sum of equally sized buckets, the kernel of Collapse.
+// Wide outputs are split over ThreadPool by columns, which keeps the order of additions of the
+// serial loop. Narrow outputs are additionally split by buckets: every thread sums a range of
+// buckets and the partial sums are added pairwise in a tree. The grouping of the tree depends on
+// the number of threads; define METANN_DETERMINISTIC_REDUCE to disable bucket splitting, so that
+// results are bitwise identical on every machine.
+namespace MetaNN::NSBucketSum
+{
+    template <typename TElem>
+    constexpr bool IsVectorised =
+#if defined(__GNUC__) || defined(__clang__)
+        std::is_same_v<TElem, float> || std::is_same_v<TElem, double>;
+#else
+        false;
+#endif
+
+    constexpr bool Deterministic =
+#ifdef METANN_DETERMINISTIC_REDUCE
+        true;
+#else
+        false;
+#endif
+
+    // Buckets narrower than this are folded into rows of several buckets, so that the inner loop
+    // still runs over full vectors.
+    constexpr size_t FoldWidth = 256;
+    // Sums of fewer elements run on the calling thread only.
+    constexpr size_t ParallelThreshold = 1 << 16;
+    // Smallest column range / bucket range handled by one task.
+    constexpr size_t MinColChunk = 512;
+    constexpr size_t MinRowChunk = 16;
+    // Rows added to the accumulator per pass: acc is read and written once per RowBlock rows.
+    constexpr size_t RowBlock = 8;
+
+#if defined(__GNUC__) || defined(__clang__)
+    template <typename TElem, size_t Bytes>
+    __attribute__((always_inline)) inline
+    void AccumulateBody(const TElem* in, size_t rowNum, size_t stride, size_t colNum, TElem* acc)
+    {
+        using TVec = SimdVec<TElem, Bytes>;
+        constexpr size_t Lanes = Bytes / sizeof(TElem);
+
+        for (size_t r0 = 0; r0 < rowNum; r0 += RowBlock)
+        {
+            const size_t rb = std::min(RowBlock, rowNum - r0);
+            const TElem* rows = in + r0 * stride;
+            size_t j = 0;
+            for (; j + Lanes <= colNum; j += Lanes)
+            {
+                TVec a;
+                std::memcpy(&a, acc + j, sizeof(TVec));
+                for (size_t r = 0; r < rb; ++r)
+                {
+                    TVec s;
+                    std::memcpy(&s, rows + r * stride + j, sizeof(TVec));
+                    a += s;
+                }
+                std::memcpy(acc + j, &a, sizeof(TVec));
+            }
+            for (; j < colNum; ++j)
+            {
+                for (size_t r = 0; r < rb; ++r)
+                {
+                    acc[j] += rows[r * stride + j];
+                }
+            }
+        }
+    }
+
+    template <typename TElem>
+    void AccumulateGeneric(const TElem* in, size_t rowNum, size_t stride, size_t colNum, TElem* acc)
+    {
+        AccumulateBody<TElem, 16>(in, rowNum, stride, colNum, acc);
+    }
+
+#ifdef METANN_X86_DISPATCH
+    template <typename TElem>
+    __attribute__((target("avx2")))
+    void AccumulateAvx2(const TElem* in, size_t rowNum, size_t stride, size_t colNum, TElem* acc)
+    {
+        AccumulateBody<TElem, 32>(in, rowNum, stride, colNum, acc);
+    }
+
+    template <typename TElem>
+    __attribute__((target("avx512f")))
+    void AccumulateAvx512(const TElem* in, size_t rowNum, size_t stride, size_t colNum, TElem* acc)
+    {
+        AccumulateBody<TElem, 64>(in, rowNum, stride, colNum, acc);
+    }
+#endif
+
+    template <typename TElem>
+    using AccumulateType = void(*)(const TElem*, size_t, size_t, size_t, TElem*);
+
+    template <typename TElem>
+    AccumulateType<TElem> SelectAccumulate()
+    {
+#ifdef METANN_X86_DISPATCH
+        switch (CpuSimdLevel())
+        {
+        case SimdLevel::Avx512:
+            return &AccumulateAvx512<TElem>;
+        case SimdLevel::Avx2:
+            return &AccumulateAvx2<TElem>;
+        default:
+            break;
+        }
+#endif
+        return &AccumulateGeneric<TElem>;
+    }
+#endif
+
+    /// acc[j] += in[r * stride + j] for r < rowNum and j < colNum, adding the rows in order.
+    template <typename TAcc, typename TElem>
+    void Accumulate(const TElem* in, size_t rowNum, size_t stride, size_t colNum, TAcc* acc)
+    {
+        if constexpr (std::is_same_v<TAcc, TElem> && IsVectorised<TElem>)
+        {
+            static const AccumulateType<TElem> accumulate = SelectAccumulate<TElem>();
+            accumulate(in, rowNum, stride, colNum, acc);
+        }
+        else
+        {
+            for (size_t r = 0; r < rowNum; ++r)
+            {
+                for (size_t j = 0; j < colNum; ++j)
+                {
+                    acc[j] += in[j];
+                }
+                in += stride;
+            }
+        }
+    }
+
+    // acc (zero initialized, width elements) += every row of the rowNum x width matrix in.
+    template <typename TAcc, typename TElem>
+    void SumRows(const TElem* in, size_t rowNum, size_t width, TAcc* acc)
+    {
+        ThreadPool& pool = ThreadPool::Inst();
+        const size_t threadNum = pool.ThreadNum();
+        if ((threadNum <= 1) || (rowNum * width < ParallelThreshold))
+        {
+            Accumulate(in, rowNum, width, width, acc);
+            return;
+        }
+
+        const size_t colTaskNum = width / MinColChunk;
+        if (Deterministic || (colTaskNum >= threadNum))
+        {
+            const size_t taskNum = std::max<size_t>(1, std::min(colTaskNum, threadNum));
+            const size_t chunk = ((width + taskNum - 1) / taskNum + 15) / 16 * 16;
+            pool.ParallelFor((width + chunk - 1) / chunk,
+                             [&](size_t task)
+                             {
+                                 const size_t beg = task * chunk;
+                                 const size_t len = std::min(chunk, width - beg);
+                                 Accumulate(in + beg, rowNum, width, len, acc + beg);
+                             });
+            return;
+        }
+
+        const size_t partNum = std::min(threadNum, rowNum / MinRowChunk);
+        if (partNum <= 1)
+        {
+            Accumulate(in, rowNum, width, width, acc);
+            return;
+        }
+        std::vector<TAcc> partials((partNum - 1) * width, TAcc{});
+        auto partAcc = [&](size_t part) { return (part == 0) ? acc : partials.data() + (part - 1) * width; };
+
+        pool.ParallelFor(partNum,
+                         [&](size_t part)
+                         {
+                             const size_t beg = rowNum * part / partNum;
+                             const size_t end = rowNum * (part + 1) / partNum;
+                             Accumulate(in + beg * width, end - beg, width, width, partAcc(part));
+                         });
+        for (size_t step = 1; step < partNum; step *= 2)
+        {
+            pool.ParallelFor((partNum + 2 * step - 1) / (2 * step),
+                             [&](size_t pair)
+                             {
+                                 const size_t dst = pair * 2 * step;
+                                 if (dst + step < partNum)
+                                 {
+                                     Accumulate(partAcc(dst + step), 1, width, width, partAcc(dst));
+                                 }
+                             });
+        }
+    }
+
+    /// out[j] = sum of in[i * bucketSize + j] over the bucketNum buckets. Low precision
+    /// elements are accumulated in their ComputeType and rounded once.
+    template <typename TElem>
+    void BucketSum(const TElem* in, size_t bucketNum, size_t bucketSize, TElem* out)
+    {
+        using TAcc = ComputeType<TElem>;
+        if (bucketSize == 0)
+        {
+            return;
+        }
+        const size_t fold = (bucketSize >= FoldWidth) ? 1 : std::max<size_t>(1, std::min(bucketNum, FoldWidth / bucketSize));
+        const size_t width = fold * bucketSize;
+        const size_t rowNum = bucketNum / fold;
+
+        if constexpr (std::is_same_v<TAcc, TElem>)
+        {
+            if (fold == 1)
+            {
+                std::fill(out, out + bucketSize, TElem{});
+                SumRows(in, rowNum, width, out);
+                return;
+            }
+        }
+
+        std::vector<TAcc> acc(width, TAcc{});
+        SumRows(in, rowNum, width, acc.data());
+        // the buckets left over by folding, then the folded buckets onto the first one.
+        Accumulate(in + rowNum * width, bucketNum - rowNum * fold, bucketSize, bucketSize, acc.data());
+        Accumulate(acc.data() + bucketSize, fold - 1, bucketSize, bucketSize, acc.data());
+        for (size_t j = 0; j < bucketSize; ++j)
+        {
+            out[j] = static_cast<TElem>(acc[j]);
+        }
+    }
+}
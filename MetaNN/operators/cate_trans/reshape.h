@@ -0,0 +1,164 @@
+#pragma once
+
+#include <MetaNN/data/facilities/lower_access.h>
+#include <MetaNN/data/facilities/shape.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/operator_frame.h>
+#include <cassert>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MetaNN::OpTags
+{
+    struct Reshape;
+}
+
+namespace MetaNN
+{
+template <typename TOriData, typename TShape>
+constexpr bool IsValidOper<OpTags::Reshape, TOriData, TShape> = IsInDataCategory<TOriData>;
+
+namespace OperReshape
+{
+    template <typename TInputHandle, typename TShape, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EvalItem(TInputHandle oriHandle, TShape shape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {oriHandle.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle(std::move(oriHandle))
+            , m_shape(std::move(shape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle m_inputHandle;
+        const TShape m_shape;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TInputHandle, typename TShape, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle, TShape, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TInputHandle, TShape, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+            assert(in.Shape().Count() == evalItem.m_shape.Count());
+
+            // the result shares the buffer of the input: only the shape is changed.
+            using ResType = typename TOutputHandle::DataType;
+            auto low_in = LowerAccess(in);
+            evalItem.m_outputHandle.SetData(ResType(low_in.SharedMemory(), evalItem.m_shape));
+        }
+    };
+
+struct Calculator
+{
+    template <typename TEvalRes, typename TOriData, typename TShape>
+    static void EvalRegister(TEvalRes& evalRes, const TOriData& oriData, const TShape& shape)
+    {
+        using DeviceType = typename TEvalRes::DataType::DeviceType;
+
+        auto handle = oriData.EvalRegister();
+        auto outHandle = evalRes.Handle();
+
+        using ItemType = EvalItem<decltype(handle), TShape, decltype(outHandle)>;
+        using GroupType = EvalGroup<decltype(handle), TShape, decltype(outHandle)>;
+        using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+        auto item = std::make_unique<ItemType>(std::move(handle), shape, std::move(outHandle));
+        EvalPlan<DeviceType>::Inst().template Register<DispatcherType>(std::move(item));
+    }
+};
+}
+
+// Note: the category of the result is determined by the aim shape,
+// so here involve a partial specification.
+template <typename TOriData, typename TCategory>
+class Operator<OpTags::Reshape, TOriData, Shape<TCategory>>
+{
+    static_assert(std::is_same_v<RemConstRef<TOriData>, TOriData>, "TOriData is not an available type.");
+
+public:
+    using CategoryTag = TCategory;
+    using ElementType = typename TOriData::ElementType;
+    using DeviceType = typename TOriData::DeviceType;
+
+public:
+    Operator(TOriData data, MetaNN::Shape<TCategory> shape)
+        : m_oriData(std::move(data))
+        , m_shape(std::move(shape))
+    {}
+
+    const auto& Shape() const noexcept
+    {
+        return m_shape;
+    }
+
+    bool operator== (const Operator& val) const
+    {
+        return (m_oriData == val.m_oriData) &&
+               (m_shape == val.m_shape);
+    }
+
+    auto EvalRegister() const
+    {
+        if (!m_evalBuf.IsEvaluated())
+        {
+            auto evalHandle = m_evalBuf.Handle();
+            if (!EvalPlan<DeviceType>::Inst().IsAlreayRegisted(evalHandle.DataPtr()))
+            {
+                OperReshape::Calculator::EvalRegister(m_evalBuf, m_oriData, m_shape);
+            }
+        }
+        return m_evalBuf.ConstHandle();
+    }
+
+    const auto& Operand() const noexcept
+    {
+        return m_oriData;
+    }
+
+private:
+    const TOriData m_oriData;
+    const MetaNN::Shape<CategoryTag> m_shape;
+
+    using TPrincipal = PrincipalDataType<CategoryTag, ElementType, DeviceType>;
+    EvalBuffer<TPrincipal> m_evalBuf;
+};
+
+/// Reinterpret data as another category or shape with the same element count.
+/// Principal data are re-wrapped at once; other data are reshaped after evaluation.
+/// In both cases the result shares the memory of the original data.
+template <typename TOriData, typename TCategory,
+          typename = std::enable_if_t<IsValidOper<OpTags::Reshape, TOriData, Shape<TCategory>>>>
+auto Reshape(TOriData&& data, const Shape<TCategory>& shape)
+{
+    if (data.Shape().Count() != shape.Count())
+    {
+        throw std::runtime_error("Reshape error: element count mismatch.");
+    }
+
+    using RawDataType = RemConstRef<TOriData>;
+    using ElementType = typename RawDataType::ElementType;
+    using DeviceType = typename RawDataType::DeviceType;
+    using OriCategory = DataCategory<RawDataType>;
+    using ResType = PrincipalDataType<TCategory, ElementType, DeviceType>;
+
+    if constexpr (std::is_same_v<RawDataType, PrincipalDataType<OriCategory, ElementType, DeviceType>>)
+    {
+        auto low_in = LowerAccess(data);
+        return ResType(low_in.SharedMemory(), shape);
+    }
+    else
+    {
+        using OperType = Operator<OpTags::Reshape, RawDataType, Shape<TCategory>>;
+        return OperType(std::forward<TOriData>(data), shape);
+    }
+}
+}
@@ -0,0 +1,4 @@
+#pragma once
+
+#include <MetaNN/operators/conv/conv2d.h>
+#include <MetaNN/operators/conv/pool2d.h>
\ No newline at end of file
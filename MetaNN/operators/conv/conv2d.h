@@ -0,0 +1,865 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/3d_array/channel_last_3d_array.h>
+#include <MetaNN/data/facilities/low_precision.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/blas/facilities/gemm.h>
+#include <MetaNN/operators/facilities/tail_calculator.h>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace MetaNN::OpTags
+{
+    struct Conv2D;
+    struct Conv2DGradInput;
+    struct Conv2DGradKernel;
+}
+
+namespace MetaNN::ConvParams
+{
+    struct RowNum;
+    struct ColNum;
+}
+
+namespace MetaNN
+{
+namespace NSConv2D
+{
+    /// Zero padding added before (head) and after (tail) the rows and columns of the input,
+    /// and the strides of the kernel window.
+    struct Geometry
+    {
+        size_t m_padHeadRow = 0;
+        size_t m_padHeadCol = 0;
+        size_t m_padTailRow = 0;
+        size_t m_padTailCol = 0;
+        size_t m_strideRow = 1;
+        size_t m_strideCol = 1;
+
+        bool operator == (const Geometry& val) const
+        {
+            return (m_padHeadRow == val.m_padHeadRow) &&
+                   (m_padHeadCol == val.m_padHeadCol) &&
+                   (m_padTailRow == val.m_padTailRow) &&
+                   (m_padTailCol == val.m_padTailCol) &&
+                   (m_strideRow == val.m_strideRow) &&
+                   (m_strideCol == val.m_strideCol);
+        }
+    };
+
+    inline size_t OutSize(size_t inSize, size_t padHead, size_t padTail,
+                          size_t stride, size_t kernelSize)
+    {
+        if (stride == 0)
+        {
+            throw std::runtime_error("Conv2D stride should be positive.");
+        }
+        const size_t paddedSize = inSize + padHead + padTail;
+        if (paddedSize < kernelSize)
+        {
+            throw std::runtime_error("Input size is less than kernel size.");
+        }
+        return (paddedSize - kernelSize) / stride + 1;
+    }
+
+    // Total padding of the "Same" mode, which gives ceil(inSize / stride) outputs.
+    inline size_t SamePadSize(size_t inSize, size_t stride, size_t kernelSize)
+    {
+        const size_t outSize = (inSize + stride - 1) / stride;
+        const size_t coverSize = (outSize - 1) * stride + kernelSize;
+        return (coverSize > inSize) ? coverSize - inSize : 0;
+    }
+
+    template <typename TCategory>
+    Shape<TCategory> OutShape(const Shape<TCategory>& input,
+                              const Shape<CategoryTags::ThreeDArraySequence>& kernel,
+                              const Geometry& geo)
+    {
+        const auto& inCardinal = input.CardinalShape();
+        const auto& kernelCardinal = kernel.Cardinal();
+        if (inCardinal.PageNum() != kernelCardinal.PageNum())
+        {
+            throw std::runtime_error("The input and kernel should have same depth!");
+        }
+        const size_t rowNum = OutSize(inCardinal.RowNum(), geo.m_padHeadRow, geo.m_padTailRow,
+                                      geo.m_strideRow, kernelCardinal.RowNum());
+        const size_t colNum = OutSize(inCardinal.ColNum(), geo.m_padHeadCol, geo.m_padTailCol,
+                                      geo.m_strideCol, kernelCardinal.ColNum());
+        if constexpr (std::is_same_v<TCategory, CategoryTags::ThreeDArray>)
+        {
+            return Shape<TCategory>(kernel.Length(), rowNum, colNum);
+        }
+        else
+        {
+            static_assert(std::is_same_v<TCategory, CategoryTags::BatchThreeDArray>);
+            return Shape<TCategory>(input.BatchNum(), kernel.Length(), rowNum, colNum);
+        }
+    }
+
+    /// Sizes of one sample: a C x H x W input, K kernels of C x KH x KW and a K x OH x OW output.
+    /// The kernels form a K x (C * KH * KW) matrix and im2col turns the input into a
+    /// (C * KH * KW) x (OH * OW) matrix, so that the convolution is their product.
+    struct Problem
+    {
+        Problem(const Shape<CategoryTags::ThreeDArray>& input,
+                const Shape<CategoryTags::ThreeDArraySequence>& kernel,
+                const Geometry& geo)
+            : m_c(input.PageNum())
+            , m_h(input.RowNum())
+            , m_w(input.ColNum())
+            , m_k(kernel.Length())
+            , m_kh(kernel.Cardinal().RowNum())
+            , m_kw(kernel.Cardinal().ColNum())
+            , m_oh(OutSize(m_h, geo.m_padHeadRow, geo.m_padTailRow, geo.m_strideRow, m_kh))
+            , m_ow(OutSize(m_w, geo.m_padHeadCol, geo.m_padTailCol, geo.m_strideCol, m_kw))
+            , m_geo(geo)
+        {
+            assert(kernel.Cardinal().PageNum() == m_c);
+        }
+
+        size_t ColRowNum() const { return m_c * m_kh * m_kw; }
+        size_t ColColNum() const { return m_oh * m_ow; }
+
+        // 1 x 1 kernels without padding and stride: the input already is the im2col matrix.
+        bool IsPointwise() const
+        {
+            return (m_kh == 1) && (m_kw == 1) &&
+                   (m_geo.m_strideRow == 1) && (m_geo.m_strideCol == 1) &&
+                   (m_geo.m_padHeadRow == 0) && (m_geo.m_padHeadCol == 0) &&
+                   (m_geo.m_padTailRow == 0) && (m_geo.m_padTailCol == 0);
+        }
+
+        size_t m_c, m_h, m_w;
+        size_t m_k, m_kh, m_kw;
+        size_t m_oh, m_ow;
+        Geometry m_geo;
+    };
+
+    // col[(c * KH + i) * KW + j][oy * OW + ox] = input(c, oy * strideRow + i - padHeadRow,
+    //                                                 ox * strideCol + j - padHeadCol), 0 in the padding.
+    template <typename TElem>
+    void Im2Col(const Problem& p, const TElem* in, TElem* col)
+    {
+        const ptrdiff_t h = (ptrdiff_t)p.m_h;
+        const ptrdiff_t w = (ptrdiff_t)p.m_w;
+        for (size_t c = 0; c < p.m_c; ++c)
+        {
+            for (size_t i = 0; i < p.m_kh; ++i)
+            {
+                for (size_t j = 0; j < p.m_kw; ++j)
+                {
+                    for (size_t oy = 0; oy < p.m_oh; ++oy)
+                    {
+                        const ptrdiff_t iy = (ptrdiff_t)(oy * p.m_geo.m_strideRow + i) - (ptrdiff_t)p.m_geo.m_padHeadRow;
+                        if ((iy < 0) || (iy >= h))
+                        {
+                            std::fill(col, col + p.m_ow, TElem{});
+                            col += p.m_ow;
+                            continue;
+                        }
+                        const TElem* src = in + (c * p.m_h + (size_t)iy) * p.m_w;
+                        for (size_t ox = 0; ox < p.m_ow; ++ox)
+                        {
+                            const ptrdiff_t ix = (ptrdiff_t)(ox * p.m_geo.m_strideCol + j) - (ptrdiff_t)p.m_geo.m_padHeadCol;
+                            col[ox] = ((ix < 0) || (ix >= w)) ? TElem{} : src[ix];
+                        }
+                        col += p.m_ow;
+                    }
+                }
+            }
+        }
+    }
+
+    // The adjoint of Im2Col: adds every column entry back to the input position it came from.
+    template <typename TElem>
+    void Col2Im(const Problem& p, const TElem* col, TElem* in)
+    {
+        const ptrdiff_t h = (ptrdiff_t)p.m_h;
+        const ptrdiff_t w = (ptrdiff_t)p.m_w;
+        for (size_t c = 0; c < p.m_c; ++c)
+        {
+            for (size_t i = 0; i < p.m_kh; ++i)
+            {
+                for (size_t j = 0; j < p.m_kw; ++j)
+                {
+                    for (size_t oy = 0; oy < p.m_oh; ++oy)
+                    {
+                        const ptrdiff_t iy = (ptrdiff_t)(oy * p.m_geo.m_strideRow + i) - (ptrdiff_t)p.m_geo.m_padHeadRow;
+                        if ((iy >= 0) && (iy < h))
+                        {
+                            TElem* dst = in + (c * p.m_h + (size_t)iy) * p.m_w;
+                            for (size_t ox = 0; ox < p.m_ow; ++ox)
+                            {
+                                const ptrdiff_t ix = (ptrdiff_t)(ox * p.m_geo.m_strideCol + j) - (ptrdiff_t)p.m_geo.m_padHeadCol;
+                                if ((ix >= 0) && (ix < w))
+                                {
+                                    dst[ix] += col[ox];
+                                }
+                            }
+                        }
+                        col += p.m_ow;
+                    }
+                }
+            }
+        }
+    }
+
+    // The channel-last counterpart of Im2Col, one patch per row:
+    // row[oy * OW + ox][(i * KW + j) * C + c] = input(c, iy, ix), where input (iy, ix, :) is a
+    // contiguous run of C channels that is copied as a whole.
+    template <typename TElem>
+    void Im2Row(const Problem& p, const TElem* in, TElem* row)
+    {
+        const ptrdiff_t h = (ptrdiff_t)p.m_h;
+        const ptrdiff_t w = (ptrdiff_t)p.m_w;
+        for (size_t oy = 0; oy < p.m_oh; ++oy)
+        {
+            for (size_t ox = 0; ox < p.m_ow; ++ox)
+            {
+                for (size_t i = 0; i < p.m_kh; ++i)
+                {
+                    const ptrdiff_t iy = (ptrdiff_t)(oy * p.m_geo.m_strideRow + i) - (ptrdiff_t)p.m_geo.m_padHeadRow;
+                    for (size_t j = 0; j < p.m_kw; ++j)
+                    {
+                        const ptrdiff_t ix = (ptrdiff_t)(ox * p.m_geo.m_strideCol + j) - (ptrdiff_t)p.m_geo.m_padHeadCol;
+                        if ((iy < 0) || (iy >= h) || (ix < 0) || (ix >= w))
+                        {
+                            std::fill(row, row + p.m_c, TElem{});
+                        }
+                        else
+                        {
+                            std::memcpy(row, in + ((size_t)iy * p.m_w + (size_t)ix) * p.m_c, p.m_c * sizeof(TElem));
+                        }
+                        row += p.m_c;
+                    }
+                }
+            }
+        }
+    }
+
+    template <typename TElem>
+    void MatMul(bool transA, bool transB, size_t m, size_t n, size_t k,
+                const TElem* a, size_t lda, const TElem* b, size_t ldb, TElem* c, size_t ldc)
+    {
+        if constexpr (NSGemm::IsSupported<TElem>)
+        {
+            NSGemm::Gemm(transA, transB, m, n, k, a, lda, b, ldb, c, ldc);
+        }
+        else
+        {
+            for (size_t i = 0; i < m; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    ComputeType<TElem> sum{};
+                    for (size_t l = 0; l < k; ++l)
+                    {
+                        sum += (transA ? a[l * lda + i] : a[i * lda + l]) *
+                               (transB ? b[j * ldb + l] : b[l * ldb + j]);
+                    }
+                    c[i * ldc + j] = static_cast<TElem>(sum);
+                }
+            }
+        }
+    }
+
+    template <typename TShape>
+    size_t SampleNum(const TShape& shape)
+    {
+        return shape.Count() / shape.CardinalShape().Count();
+    }
+}
+
+template <typename TInput, typename TKernel>
+constexpr bool IsValidOper<OpTags::Conv2D, TInput, TKernel> =
+    (IsThreeDArray<TInput> || IsBatchThreeDArray<TInput>) && IsThreeDArraySequence<TKernel>;
+
+template <typename TInputCate>
+struct OperCategory_<OpTags::Conv2D, TInputCate, CategoryTags::ThreeDArraySequence>
+{
+    using type = TInputCate;
+};
+
+template <typename TCate>
+class OperAuxParams<OpTags::Conv2D, TCate> : public NSConv2D::Geometry
+{
+public:
+    explicit OperAuxParams(const NSConv2D::Geometry& geo)
+        : NSConv2D::Geometry(geo)
+    {}
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::Conv2D, TCate>
+{
+public:
+    template <typename TInput, typename TKernel>
+    OperShapeInfo(const OperAuxParams<OpTags::Conv2D, TCate>& auxParams,
+                  const TInput& input, const TKernel& kernel)
+        : m_shape(NSConv2D::OutShape(input.Shape(), kernel.Shape(), auxParams))
+    {}
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<TCate> m_shape;
+};
+
+namespace OperConv2D::NSCaseGen
+{
+    template <typename TInputHandle, typename TKernelHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TInputHandle inputHandle, TKernelHandle kernelHandle,
+                 TOutputHandle outputHandle, const TAuxParams& auxParams)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {inputHandle.DataPtr(), kernelHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_inputHandle(std::move(inputHandle))
+            , m_kernelHandle(std::move(kernelHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_geometry(auxParams)
+        {}
+
+        const TInputHandle m_inputHandle;
+        const TKernelHandle m_kernelHandle;
+        TOutputHandle m_outputHandle;
+        const NSConv2D::Geometry m_geometry;
+    };
+
+    // out (K x OH*OW) = kernel (K x C*KH*KW) * im2col(input) for every sample.
+    template <typename TInputHandle, typename TKernelHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TInputHandle, TKernelHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TInputHandle, TKernelHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+            const auto& kernel = evalItem.m_kernelHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(NSConv2D::OutShape(in.Shape(), kernel.Shape(), evalItem.m_geometry));
+
+            const NSConv2D::Problem p(in.Shape().CardinalShape(), kernel.Shape(), evalItem.m_geometry);
+            const size_t sampleNum = NSConv2D::SampleNum(in.Shape());
+            const size_t inSize = in.Shape().CardinalShape().Count();
+            const size_t outSize = out.Shape().CardinalShape().Count();
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_kernel = LowerAccess(kernel);
+            const ElementType* mem_kernel = low_kernel.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::vector<ElementType> col(p.IsPointwise() ? 0 : p.ColRowNum() * p.ColColNum());
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                const ElementType* mem_col = mem_in;
+                if (!p.IsPointwise())
+                {
+                    NSConv2D::Im2Col(p, mem_in, col.data());
+                    mem_col = col.data();
+                }
+                NSConv2D::MatMul(false, false, p.m_k, p.ColColNum(), p.ColRowNum(),
+                                 mem_kernel, p.ColRowNum(), mem_col, p.ColColNum(),
+                                 mem_out, p.ColColNum());
+                mem_in += inSize;
+                mem_out += outSize;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+namespace OperConv2D::NSCaseChannelLast
+{
+    // Channel-last input: out (K x OH*OW) = kernel (K x KH*KW*C) * transpose(im2row(input)),
+    // where the kernels are reordered once to the channel-last patch order.
+    template <typename TInputHandle, typename TKernelHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<TInputHandle, TKernelHandle, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<TInputHandle, TKernelHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+            const auto& kernel = evalItem.m_kernelHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(NSConv2D::OutShape(in.Shape(), kernel.Shape(), evalItem.m_geometry));
+
+            const NSConv2D::Problem p(in.Shape().CardinalShape(), kernel.Shape(), evalItem.m_geometry);
+            const size_t sampleNum = NSConv2D::SampleNum(in.Shape());
+            const size_t inSize = in.Shape().CardinalShape().Count();
+            const size_t outSize = out.Shape().CardinalShape().Count();
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_kernel = LowerAccess(kernel);
+            const ElementType* mem_kernel = low_kernel.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            const size_t patchSize = p.ColRowNum();
+            std::vector<ElementType> kernelCL(p.m_k * patchSize);
+            for (size_t k = 0; k < p.m_k; ++k)
+            {
+                NSChannelLast::ToChannelLast(mem_kernel + k * patchSize, kernelCL.data() + k * patchSize,
+                                             p.m_c, p.m_kh * p.m_kw);
+            }
+
+            std::vector<ElementType> row(p.IsPointwise() ? 0 : p.ColColNum() * patchSize);
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                const ElementType* mem_row = mem_in;
+                if (!p.IsPointwise())
+                {
+                    NSConv2D::Im2Row(p, mem_in, row.data());
+                    mem_row = row.data();
+                }
+                NSConv2D::MatMul(false, true, p.m_k, p.ColColNum(), patchSize,
+                                 kernelCL.data(), patchSize, mem_row, patchSize,
+                                 mem_out, p.ColColNum());
+                mem_in += inSize;
+                mem_out += outSize;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        if constexpr (!IsChannelLast<TOperand0>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = MakeConstEvalHandle(oper.template Operand<0>());
+            auto handle2 = oper.template Operand<1>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2),
+                                                   std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+template <>
+struct OperSeq_<OpTags::Conv2D>
+{
+    using type = OperCalAlgoChain<OperConv2D::NSCaseChannelLast::Calculator,
+                                  TailCalculator<OperConv2D::NSCaseGen::EvalItem, OperConv2D::NSCaseGen::EvalGroup>>;
+};
+
+template <typename TInput, typename TKernel,
+          typename = std::enable_if_t<IsValidOper<OpTags::Conv2D, RemConstRef<TInput>, RemConstRef<TKernel>>>>
+auto Conv2D(TInput&& p_input, TKernel&& p_kernel, const NSConv2D::Geometry& p_geometry)
+{
+    using rawInput = RemConstRef<TInput>;
+    using rawKernel = RemConstRef<TKernel>;
+    static_assert(std::is_same_v<typename rawInput::ElementType, typename rawKernel::ElementType>,
+                  "Different element types cannot conv directly");
+    static_assert(std::is_same_v<typename rawInput::DeviceType, typename rawKernel::DeviceType>,
+                  "Different device types cannot conv directly");
+
+    using ResType = Operator<OpTags::Conv2D, rawInput, rawKernel>;
+    using AuxType = OperAuxParams<OpTags::Conv2D, typename ResType::CategoryTag>;
+    return ResType(AuxType(p_geometry), std::forward<TInput>(p_input), std::forward<TKernel>(p_kernel));
+}
+
+/// Convolution with "Default" padding mode: explicit head / tail padding and strides, each
+/// given as a container with ConvParams::RowNum and ConvParams::ColNum entries.
+template <typename TInput, typename TKernel,
+          typename TPadHeadValueCont, typename TPadTailValueCont, typename TStrideValueCont,
+          typename = std::enable_if_t<IsValidOper<OpTags::Conv2D, RemConstRef<TInput>, RemConstRef<TKernel>>>>
+auto DefaultConv(TInput&& p_input, TKernel&& p_kernel,
+                 const TPadHeadValueCont& p_padHead, const TPadTailValueCont& p_padTail,
+                 const TStrideValueCont& p_strides)
+{
+    NSConv2D::Geometry geo;
+    geo.m_padHeadRow = (size_t)p_padHead.template Get<ConvParams::RowNum>();
+    geo.m_padHeadCol = (size_t)p_padHead.template Get<ConvParams::ColNum>();
+    geo.m_padTailRow = (size_t)p_padTail.template Get<ConvParams::RowNum>();
+    geo.m_padTailCol = (size_t)p_padTail.template Get<ConvParams::ColNum>();
+    geo.m_strideRow = (size_t)p_strides.template Get<ConvParams::RowNum>();
+    geo.m_strideCol = (size_t)p_strides.template Get<ConvParams::ColNum>();
+    return Conv2D(std::forward<TInput>(p_input), std::forward<TKernel>(p_kernel), geo);
+}
+
+/// Convolution with "Same" padding mode: the output has ceil(size / stride) rows and columns,
+/// the padding is split evenly with the odd element at the tail.
+template <typename TInput, typename TKernel, typename TStrideValueCont,
+          typename = std::enable_if_t<IsValidOper<OpTags::Conv2D, RemConstRef<TInput>, RemConstRef<TKernel>>>>
+auto SameConv(TInput&& p_input, TKernel&& p_kernel, const TStrideValueCont& p_strides)
+{
+    NSConv2D::Geometry geo;
+    geo.m_strideRow = (size_t)p_strides.template Get<ConvParams::RowNum>();
+    geo.m_strideCol = (size_t)p_strides.template Get<ConvParams::ColNum>();
+    if ((geo.m_strideRow == 0) || (geo.m_strideCol == 0))
+    {
+        throw std::runtime_error("Conv2D stride should be positive.");
+    }
+
+    const auto& inShape = p_input.Shape().CardinalShape();
+    const auto& kernelShape = p_kernel.Shape().Cardinal();
+    const size_t rowPad = NSConv2D::SamePadSize(inShape.RowNum(), geo.m_strideRow, kernelShape.RowNum());
+    const size_t colPad = NSConv2D::SamePadSize(inShape.ColNum(), geo.m_strideCol, kernelShape.ColNum());
+    geo.m_padHeadRow = rowPad / 2;
+    geo.m_padHeadCol = colPad / 2;
+    geo.m_padTailRow = rowPad - geo.m_padHeadRow;
+    geo.m_padTailCol = colPad - geo.m_padHeadCol;
+    return Conv2D(std::forward<TInput>(p_input), std::forward<TKernel>(p_kernel), geo);
+}
+}
+
+namespace MetaNN
+{
+template <typename TGrad, typename TKernel>
+constexpr bool IsValidOper<OpTags::Conv2DGradInput, TGrad, TKernel> =
+    (IsThreeDArray<TGrad> || IsBatchThreeDArray<TGrad>) && IsThreeDArraySequence<TKernel>;
+
+template <typename TGradCate>
+struct OperCategory_<OpTags::Conv2DGradInput, TGradCate, CategoryTags::ThreeDArraySequence>
+{
+    using type = TGradCate;
+};
+
+template <typename TCate>
+class OperAuxParams<OpTags::Conv2DGradInput, TCate> : public NSConv2D::Geometry
+{
+public:
+    OperAuxParams(const NSConv2D::Geometry& geo, MetaNN::Shape<TCate> inputShape)
+        : NSConv2D::Geometry(geo)
+        , m_inputShape(std::move(inputShape))
+    {}
+
+    bool operator == (const OperAuxParams& val) const
+    {
+        return NSConv2D::Geometry::operator==(val) &&
+               (m_inputShape == val.m_inputShape);
+    }
+
+    const MetaNN::Shape<TCate> m_inputShape;
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::Conv2DGradInput, TCate>
+{
+public:
+    template <typename TGrad, typename TKernel>
+    OperShapeInfo(const OperAuxParams<OpTags::Conv2DGradInput, TCate>& auxParams,
+                  const TGrad& grad, const TKernel& kernel)
+        : m_shape(auxParams.m_inputShape)
+    {
+        if (NSConv2D::OutShape(m_shape, kernel.Shape(), auxParams) != grad.Shape())
+        {
+            throw std::runtime_error("Conv2DGradInput error: gradient shape mismatch.");
+        }
+    }
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<TCate> m_shape;
+};
+
+namespace OperConv2DGradInput::NSCaseGen
+{
+    template <typename TGradHandle, typename TKernelHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ShapeType = MetaNN::Shape<typename TOutputHandle::DataType::CategoryTag>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TGradHandle gradHandle, TKernelHandle kernelHandle,
+                 TOutputHandle outputHandle, const TAuxParams& auxParams)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {gradHandle.DataPtr(), kernelHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_gradHandle(std::move(gradHandle))
+            , m_kernelHandle(std::move(kernelHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_geometry(auxParams)
+            , m_inputShape(auxParams.m_inputShape)
+        {}
+
+        const TGradHandle m_gradHandle;
+        const TKernelHandle m_kernelHandle;
+        TOutputHandle m_outputHandle;
+        const NSConv2D::Geometry m_geometry;
+        const ShapeType m_inputShape;
+    };
+
+    // input grad = col2im(kernel^T (C*KH*KW x K) * grad (K x OH*OW)) for every sample.
+    template <typename TGradHandle, typename TKernelHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TGradHandle, TKernelHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TGradHandle, TKernelHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& grad = evalItem.m_gradHandle.Data();
+            const auto& kernel = evalItem.m_kernelHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_inputShape);
+
+            const NSConv2D::Problem p(out.Shape().CardinalShape(), kernel.Shape(), evalItem.m_geometry);
+            const size_t sampleNum = NSConv2D::SampleNum(out.Shape());
+            const size_t inSize = out.Shape().CardinalShape().Count();
+            const size_t gradSize = grad.Shape().CardinalShape().Count();
+            assert(gradSize == p.m_k * p.ColColNum());
+
+            auto low_grad = LowerAccess(grad);
+            const ElementType* mem_grad = low_grad.RawMemory();
+            auto low_kernel = LowerAccess(kernel);
+            const ElementType* mem_kernel = low_kernel.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::vector<ElementType> col(p.IsPointwise() ? 0 : p.ColRowNum() * p.ColColNum());
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                ElementType* mem_col = p.IsPointwise() ? mem_out : col.data();
+                NSConv2D::MatMul(true, false, p.ColRowNum(), p.ColColNum(), p.m_k,
+                                 mem_kernel, p.ColRowNum(), mem_grad, p.ColColNum(),
+                                 mem_col, p.ColColNum());
+                if (!p.IsPointwise())
+                {
+                    std::fill(mem_out, mem_out + inSize, ElementType{});
+                    NSConv2D::Col2Im(p, col.data(), mem_out);
+                }
+                mem_grad += gradSize;
+                mem_out += inSize;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+template <>
+struct OperSeq_<OpTags::Conv2DGradInput>
+{
+    using type = OperCalAlgoChain<TailCalculator<OperConv2DGradInput::NSCaseGen::EvalItem,
+                                                 OperConv2DGradInput::NSCaseGen::EvalGroup>>;
+};
+
+/// Gradient of Conv2D with respect to its input, given the output gradient, the kernels,
+/// the geometry of the forward convolution (its AuxParams()) and the input shape.
+template <typename TGrad, typename TKernel,
+          typename = std::enable_if_t<IsValidOper<OpTags::Conv2DGradInput, RemConstRef<TGrad>, RemConstRef<TKernel>>>>
+auto Conv2DGradInput(TGrad&& p_grad, TKernel&& p_kernel, const NSConv2D::Geometry& p_geometry,
+                     Shape<DataCategory<RemConstRef<TGrad>>> p_inputShape)
+{
+    using ResType = Operator<OpTags::Conv2DGradInput, RemConstRef<TGrad>, RemConstRef<TKernel>>;
+    using AuxType = OperAuxParams<OpTags::Conv2DGradInput, typename ResType::CategoryTag>;
+    return ResType(AuxType(p_geometry, std::move(p_inputShape)),
+                   std::forward<TGrad>(p_grad), std::forward<TKernel>(p_kernel));
+}
+}
+
+namespace MetaNN
+{
+template <typename TGrad, typename TInput>
+constexpr bool IsValidOper<OpTags::Conv2DGradKernel, TGrad, TInput> =
+    (IsThreeDArray<TGrad> && IsThreeDArray<TInput>) ||
+    (IsBatchThreeDArray<TGrad> && IsBatchThreeDArray<TInput>);
+
+template <typename TGradCate, typename TInputCate>
+struct OperCategory_<OpTags::Conv2DGradKernel, TGradCate, TInputCate>
+{
+    using type = CategoryTags::ThreeDArraySequence;
+};
+
+template <>
+class OperAuxParams<OpTags::Conv2DGradKernel, CategoryTags::ThreeDArraySequence> : public NSConv2D::Geometry
+{
+public:
+    OperAuxParams(const NSConv2D::Geometry& geo, MetaNN::Shape<CategoryTags::ThreeDArraySequence> kernelShape)
+        : NSConv2D::Geometry(geo)
+        , m_kernelShape(std::move(kernelShape))
+    {}
+
+    bool operator == (const OperAuxParams& val) const
+    {
+        return NSConv2D::Geometry::operator==(val) &&
+               (m_kernelShape == val.m_kernelShape);
+    }
+
+    const MetaNN::Shape<CategoryTags::ThreeDArraySequence> m_kernelShape;
+};
+
+template <>
+class OperShapeInfo<OpTags::Conv2DGradKernel, CategoryTags::ThreeDArraySequence>
+{
+public:
+    template <typename TGrad, typename TInput>
+    OperShapeInfo(const OperAuxParams<OpTags::Conv2DGradKernel, CategoryTags::ThreeDArraySequence>& auxParams,
+                  const TGrad& grad, const TInput& input)
+        : m_shape(auxParams.m_kernelShape)
+    {
+        if (NSConv2D::OutShape(input.Shape(), m_shape, auxParams) != grad.Shape())
+        {
+            throw std::runtime_error("Conv2DGradKernel error: gradient shape mismatch.");
+        }
+    }
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<CategoryTags::ThreeDArraySequence> m_shape;
+};
+
+namespace OperConv2DGradKernel::NSCaseGen
+{
+    template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TGradHandle gradHandle, TInputHandle inputHandle,
+                 TOutputHandle outputHandle, const TAuxParams& auxParams)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {gradHandle.DataPtr(), inputHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_gradHandle(std::move(gradHandle))
+            , m_inputHandle(std::move(inputHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_geometry(auxParams)
+            , m_kernelShape(auxParams.m_kernelShape)
+        {}
+
+        const TGradHandle m_gradHandle;
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+        const NSConv2D::Geometry m_geometry;
+        const Shape<CategoryTags::ThreeDArraySequence> m_kernelShape;
+    };
+
+    // kernel grad = sum over samples of grad (K x OH*OW) * im2col(input)^T.
+    template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TGradHandle, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TGradHandle, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& grad = evalItem.m_gradHandle.Data();
+            const auto& in = evalItem.m_inputHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_kernelShape);
+
+            const NSConv2D::Problem p(in.Shape().CardinalShape(), out.Shape(), evalItem.m_geometry);
+            const size_t sampleNum = NSConv2D::SampleNum(in.Shape());
+            const size_t inSize = in.Shape().CardinalShape().Count();
+            const size_t gradSize = grad.Shape().CardinalShape().Count();
+            const size_t outCount = out.Shape().Count();
+            assert(gradSize == p.m_k * p.ColColNum());
+            assert(outCount == p.m_k * p.ColRowNum());
+
+            auto low_grad = LowerAccess(grad);
+            const ElementType* mem_grad = low_grad.RawMemory();
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::fill(mem_out, mem_out + outCount, ElementType{});
+            std::vector<ElementType> col(p.IsPointwise() ? 0 : p.ColRowNum() * p.ColColNum());
+            std::vector<ElementType> sampleGrad(sampleNum > 1 ? outCount : 0);
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                const ElementType* mem_col = mem_in;
+                if (!p.IsPointwise())
+                {
+                    NSConv2D::Im2Col(p, mem_in, col.data());
+                    mem_col = col.data();
+                }
+                ElementType* mem_dst = (sampleNum > 1) ? sampleGrad.data() : mem_out;
+                NSConv2D::MatMul(false, true, p.m_k, p.ColRowNum(), p.ColColNum(),
+                                 mem_grad, p.ColColNum(), mem_col, p.ColColNum(),
+                                 mem_dst, p.ColRowNum());
+                if (sampleNum > 1)
+                {
+                    for (size_t i = 0; i < outCount; ++i)
+                    {
+                        mem_out[i] += sampleGrad[i];
+                    }
+                }
+                mem_grad += gradSize;
+                mem_in += inSize;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+template <>
+struct OperSeq_<OpTags::Conv2DGradKernel>
+{
+    using type = OperCalAlgoChain<TailCalculator<OperConv2DGradKernel::NSCaseGen::EvalItem,
+                                                 OperConv2DGradKernel::NSCaseGen::EvalGroup>>;
+};
+
+/// Gradient of Conv2D with respect to its kernels, summed over the batch, given the output
+/// gradient, the input, the geometry of the forward convolution and the kernel shape.
+template <typename TGrad, typename TInput,
+          typename = std::enable_if_t<IsValidOper<OpTags::Conv2DGradKernel, RemConstRef<TGrad>, RemConstRef<TInput>>>>
+auto Conv2DGradKernel(TGrad&& p_grad, TInput&& p_input, const NSConv2D::Geometry& p_geometry,
+                      Shape<CategoryTags::ThreeDArraySequence> p_kernelShape)
+{
+    using ResType = Operator<OpTags::Conv2DGradKernel, RemConstRef<TGrad>, RemConstRef<TInput>>;
+    using AuxType = OperAuxParams<OpTags::Conv2DGradKernel, CategoryTags::ThreeDArraySequence>;
+    return ResType(AuxType(p_geometry, std::move(p_kernelShape)),
+                   std::forward<TGrad>(p_grad), std::forward<TInput>(p_input));
+}
+}
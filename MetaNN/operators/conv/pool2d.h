@@ -0,0 +1,838 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/3d_array/channel_last_3d_array.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/facilities/simd.h>
+#include <MetaNN/facilities/thread_pool.h>
+#include <MetaNN/operators/facilities/tail_calculator.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MetaNN::OpTags
+{
+    struct MaxPool2D;
+    struct AvgPool2D;
+    struct MaxPool2DGrad;
+    struct AvgPool2DGrad;
+}
+
+namespace MetaNN::ConvParams
+{
+    struct RowNum;
+    struct ColNum;
+}
+
+namespace MetaNN
+{
+namespace NSPool2D
+{
+    /// Pooling window and its strides. Windows never cross the border of the input:
+    /// trailing rows / columns that do not fill a window are dropped.
+    struct Window
+    {
+        size_t m_rowNum = 1;
+        size_t m_colNum = 1;
+        size_t m_strideRow = 1;
+        size_t m_strideCol = 1;
+
+        bool operator == (const Window& val) const
+        {
+            return (m_rowNum == val.m_rowNum) && (m_colNum == val.m_colNum) &&
+                   (m_strideRow == val.m_strideRow) && (m_strideCol == val.m_strideCol);
+        }
+
+        size_t Size() const { return m_rowNum * m_colNum; }
+    };
+
+    inline size_t OutSize(size_t inSize, size_t windowSize, size_t stride)
+    {
+        if ((windowSize == 0) || (stride == 0))
+        {
+            throw std::runtime_error("Pooling window and stride should be positive.");
+        }
+        if (inSize < windowSize)
+        {
+            throw std::runtime_error("Input size is less than pooling window size.");
+        }
+        return (inSize - windowSize) / stride + 1;
+    }
+
+    template <typename TShape>
+    TShape OutShape(const TShape& input, const Window& window)
+    {
+        TShape res = input;
+        res.RowNum() = OutSize(input.RowNum(), window.m_rowNum, window.m_strideRow);
+        res.ColNum() = OutSize(input.ColNum(), window.m_colNum, window.m_strideCol);
+        return res;
+    }
+
+    // Reading at least this many elements splits the planes (pages of all samples) over ThreadPool.
+    constexpr size_t ParallelThreshold = 1 << 15;
+
+    template <typename TFun>
+    void ForEachPlane(size_t planeNum, size_t work, TFun&& fun)
+    {
+        if ((planeNum > 1) && (work >= ParallelThreshold))
+        {
+            ThreadPool::Inst().ParallelFor(planeNum, fun);
+        }
+        else
+        {
+            for (size_t i = 0; i < planeNum; ++i)
+            {
+                fun(i);
+            }
+        }
+    }
+
+    template <typename TElem>
+    constexpr bool IsVectorised =
+#if defined(__GNUC__) || defined(__clang__)
+        std::is_same_v<TElem, float> || std::is_same_v<TElem, double>;
+#else
+        false;
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+    // acc[i] = max(acc[i], src[i]) or acc[i] += src[i] on Bytes-wide vectors.
+    template <bool IsMax, typename TElem, size_t Bytes>
+    __attribute__((always_inline)) inline
+    void RowBody(const TElem* src, TElem* acc, size_t count)
+    {
+        using TVec = SimdVec<TElem, Bytes>;
+        constexpr size_t Lanes = Bytes / sizeof(TElem);
+
+        size_t i = 0;
+        for (; i + Lanes <= count; i += Lanes)
+        {
+            TVec s, a;
+            std::memcpy(&s, src + i, sizeof(TVec));
+            std::memcpy(&a, acc + i, sizeof(TVec));
+            if constexpr (IsMax)
+            {
+                a = (s > a) ? s : a;
+            }
+            else
+            {
+                a += s;
+            }
+            std::memcpy(acc + i, &a, sizeof(TVec));
+        }
+        for (; i < count; ++i)
+        {
+            acc[i] = IsMax ? std::max(acc[i], src[i]) : acc[i] + src[i];
+        }
+    }
+
+    template <bool IsMax, typename TElem>
+    void RowGeneric(const TElem* src, TElem* acc, size_t count)
+    {
+        RowBody<IsMax, TElem, 16>(src, acc, count);
+    }
+
+#ifdef METANN_X86_DISPATCH
+    template <bool IsMax, typename TElem>
+    __attribute__((target("avx2")))
+    void RowAvx2(const TElem* src, TElem* acc, size_t count)
+    {
+        RowBody<IsMax, TElem, 32>(src, acc, count);
+    }
+
+    template <bool IsMax, typename TElem>
+    __attribute__((target("avx512f")))
+    void RowAvx512(const TElem* src, TElem* acc, size_t count)
+    {
+        RowBody<IsMax, TElem, 64>(src, acc, count);
+    }
+#endif
+
+    template <typename TElem>
+    using RowType = void(*)(const TElem*, TElem*, size_t);
+
+    template <bool IsMax, typename TElem>
+    RowType<TElem> SelectRow()
+    {
+#ifdef METANN_X86_DISPATCH
+        switch (CpuSimdLevel())
+        {
+        case SimdLevel::Avx512:
+            return &RowAvx512<IsMax, TElem>;
+        case SimdLevel::Avx2:
+            return &RowAvx2<IsMax, TElem>;
+        default:
+            break;
+        }
+#endif
+        return &RowGeneric<IsMax, TElem>;
+    }
+#endif
+
+    /// acc[i] = max(acc[i], src[i]) (IsMax) or acc[i] += src[i] for contiguous rows.
+    template <bool IsMax, typename TElem>
+    void RowAccumulate(const TElem* src, TElem* acc, size_t count)
+    {
+        if constexpr (IsVectorised<TElem>)
+        {
+            static const RowType<TElem> row = SelectRow<IsMax, TElem>();
+            row(src, acc, count);
+        }
+        else
+        {
+            for (size_t i = 0; i < count; ++i)
+            {
+                acc[i] = IsMax ? std::max(acc[i], src[i]) : acc[i] + src[i];
+            }
+        }
+    }
+
+    /// Pools one H x W plane into OH x OW. With unit column stride every window offset is a
+    /// contiguous row operation on whole output rows.
+    template <bool IsMax, typename TElem>
+    void PoolPlane(const Window& window, size_t w, size_t oh, size_t ow,
+                   const TElem* in, TElem* out)
+    {
+        for (size_t oy = 0; oy < oh; ++oy)
+        {
+            TElem* acc = out + oy * ow;
+            const TElem* rows = in + oy * window.m_strideRow * w;
+            if (window.m_strideCol == 1)
+            {
+                std::copy(rows, rows + ow, acc);
+                for (size_t i = 0; i < window.m_rowNum; ++i)
+                {
+                    for (size_t j = (i == 0) ? 1 : 0; j < window.m_colNum; ++j)
+                    {
+                        RowAccumulate<IsMax>(rows + i * w + j, acc, ow);
+                    }
+                }
+            }
+            else
+            {
+                for (size_t ox = 0; ox < ow; ++ox)
+                {
+                    const TElem* src = rows + ox * window.m_strideCol;
+                    TElem value = src[0];
+                    for (size_t i = 0; i < window.m_rowNum; ++i)
+                    {
+                        for (size_t j = (i == 0) ? 1 : 0; j < window.m_colNum; ++j)
+                        {
+                            value = IsMax ? std::max(value, src[i * w + j]) : value + src[i * w + j];
+                        }
+                    }
+                    acc[ox] = value;
+                }
+            }
+            if constexpr (!IsMax)
+            {
+                const TElem scale = static_cast<TElem>(1) / static_cast<TElem>(window.Size());
+                for (size_t ox = 0; ox < ow; ++ox)
+                {
+                    acc[ox] *= scale;
+                }
+            }
+        }
+    }
+
+    template <typename TShape>
+    size_t PlaneNum(const TShape& shape)
+    {
+        return shape.Count() / (shape.RowNum() * shape.ColNum());
+    }
+
+    template <typename TValueCont>
+    std::pair<size_t, size_t> ReadParams(const TValueCont& cont)
+    {
+        return {(size_t)cont.template Get<ConvParams::RowNum>(),
+                (size_t)cont.template Get<ConvParams::ColNum>()};
+    }
+}
+
+template <typename TOpTag, typename TCate>
+class OperPool2DAuxParams : public NSPool2D::Window
+{
+public:
+    explicit OperPool2DAuxParams(const NSPool2D::Window& window)
+        : NSPool2D::Window(window)
+    {}
+};
+
+template <typename TCate>
+class OperAuxParams<OpTags::MaxPool2D, TCate> : public OperPool2DAuxParams<OpTags::MaxPool2D, TCate>
+{
+public:
+    using OperPool2DAuxParams<OpTags::MaxPool2D, TCate>::OperPool2DAuxParams;
+};
+
+template <typename TCate>
+class OperAuxParams<OpTags::AvgPool2D, TCate> : public OperPool2DAuxParams<OpTags::AvgPool2D, TCate>
+{
+public:
+    using OperPool2DAuxParams<OpTags::AvgPool2D, TCate>::OperPool2DAuxParams;
+};
+
+template <typename TOpTag, typename TCate>
+class OperPool2DShapeInfo
+{
+public:
+    template <typename TInput>
+    OperPool2DShapeInfo(const OperAuxParams<TOpTag, TCate>& auxParams, const TInput& input)
+        : m_shape(NSPool2D::OutShape(input.Shape(), auxParams))
+    {}
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<TCate> m_shape;
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::MaxPool2D, TCate> : public OperPool2DShapeInfo<OpTags::MaxPool2D, TCate>
+{
+public:
+    using OperPool2DShapeInfo<OpTags::MaxPool2D, TCate>::OperPool2DShapeInfo;
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::AvgPool2D, TCate> : public OperPool2DShapeInfo<OpTags::AvgPool2D, TCate>
+{
+public:
+    using OperPool2DShapeInfo<OpTags::AvgPool2D, TCate>::OperPool2DShapeInfo;
+};
+
+template <typename TInput>
+constexpr bool IsValidOper<OpTags::MaxPool2D, TInput> = IsThreeDArray<TInput> || IsBatchThreeDArray<TInput>;
+
+template <typename TInput>
+constexpr bool IsValidOper<OpTags::AvgPool2D, TInput> = IsThreeDArray<TInput> || IsBatchThreeDArray<TInput>;
+
+namespace OperPool2D::NSCaseGen
+{
+    template <bool IsMax, typename TInputHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EvalItem(TInputHandle inputHandle, TOutputHandle outputHandle, const NSPool2D::Window& window)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {inputHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_inputHandle(std::move(inputHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_window(window)
+        {}
+
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+        const NSPool2D::Window m_window;
+    };
+
+    template <bool IsMax, typename TInputHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<IsMax, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<IsMax, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+            const auto& window = evalItem.m_window;
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(NSPool2D::OutShape(in.Shape(), window));
+
+            const size_t h = in.Shape().RowNum();
+            const size_t w = in.Shape().ColNum();
+            const size_t oh = out.Shape().RowNum();
+            const size_t ow = out.Shape().ColNum();
+            const size_t planeNum = NSPool2D::PlaneNum(in.Shape());
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            NSPool2D::ForEachPlane(planeNum, out.Shape().Count() * window.Size(),
+                                   [&](size_t plane)
+                                   {
+                                       NSPool2D::PoolPlane<IsMax>(window, w, oh, ow,
+                                                                  mem_in + plane * h * w,
+                                                                  mem_out + plane * oh * ow);
+                                   });
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename TInputHandle, typename TOutputHandle>
+    using MaxEvalItem = EvalItem<true, TInputHandle, TOutputHandle>;
+
+    template <typename TInputHandle, typename TOutputHandle>
+    using MaxEvalGroup = EvalGroup<true, TInputHandle, TOutputHandle>;
+
+    template <typename TInputHandle, typename TOutputHandle>
+    using AvgEvalItem = EvalItem<false, TInputHandle, TOutputHandle>;
+
+    template <typename TInputHandle, typename TOutputHandle>
+    using AvgEvalGroup = EvalGroup<false, TInputHandle, TOutputHandle>;
+}
+
+namespace OperPool2D::NSCaseChannelLast
+{
+    // Channel-last input: every output position accumulates the contiguous channel runs of
+    // its window into a channel-last row, which is turned back to page-major per sample.
+    template <bool IsMax, typename TInputHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<NSCaseGen::EvalItem<IsMax, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = NSCaseGen::EvalItem<IsMax, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+            const auto& window = evalItem.m_window;
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(NSPool2D::OutShape(in.Shape(), window));
+
+            const size_t c = in.Shape().CardinalShape().PageNum();
+            const size_t h = in.Shape().RowNum();
+            const size_t w = in.Shape().ColNum();
+            const size_t oh = out.Shape().RowNum();
+            const size_t ow = out.Shape().ColNum();
+            const size_t sampleNum = in.Shape().Count() / in.Shape().CardinalShape().Count();
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::vector<ElementType> buf(out.Shape().Count());
+            NSPool2D::ForEachPlane(sampleNum * oh, out.Shape().Count() * window.Size(),
+                                   [&](size_t line)
+                                   {
+                                       const size_t oy = line % oh;
+                                       const ElementType* sample = mem_in + line / oh * c * h * w;
+                                       ElementType* acc = buf.data() + line * ow * c;
+                                       for (size_t ox = 0; ox < ow; ++ox, acc += c)
+                                       {
+                                           const ElementType* src = sample + (oy * window.m_strideRow * w + ox * window.m_strideCol) * c;
+                                           std::copy(src, src + c, acc);
+                                           for (size_t i = 0; i < window.m_rowNum; ++i)
+                                           {
+                                               for (size_t j = (i == 0) ? 1 : 0; j < window.m_colNum; ++j)
+                                               {
+                                                   NSPool2D::RowAccumulate<IsMax>(src + (i * w + j) * c, acc, c);
+                                               }
+                                           }
+                                           if constexpr (!IsMax)
+                                           {
+                                               const ElementType scale = static_cast<ElementType>(1) / static_cast<ElementType>(window.Size());
+                                               for (size_t k = 0; k < c; ++k)
+                                               {
+                                                   acc[k] *= scale;
+                                               }
+                                           }
+                                       }
+                                   });
+
+            const size_t sampleSize = c * oh * ow;
+            for (size_t s = 0; s < sampleNum; ++s)
+            {
+                NSChannelLast::ToPageMajor(buf.data() + s * sampleSize, mem_out + s * sampleSize, c, oh * ow);
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+template <bool IsMax>
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        if constexpr (!IsChannelLast<TOperand0>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle = MakeConstEvalHandle(oper.template Operand<0>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = NSCaseGen::EvalItem<IsMax, decltype(handle), decltype(outHandle)>;
+            using GroupType = EvalGroup<IsMax, decltype(handle), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle), std::move(outHandle), oper.AuxParams());
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
+
+template <>
+struct OperSeq_<OpTags::MaxPool2D>
+{
+    using type = OperCalAlgoChain<OperPool2D::NSCaseChannelLast::Calculator<true>,
+                                  TailCalculator<OperPool2D::NSCaseGen::MaxEvalItem,
+                                                 OperPool2D::NSCaseGen::MaxEvalGroup>>;
+};
+
+template <>
+struct OperSeq_<OpTags::AvgPool2D>
+{
+    using type = OperCalAlgoChain<OperPool2D::NSCaseChannelLast::Calculator<false>,
+                                  TailCalculator<OperPool2D::NSCaseGen::AvgEvalItem,
+                                                 OperPool2D::NSCaseGen::AvgEvalGroup>>;
+};
+
+/// Max pooling over a window of windowSize rows / columns moved by strides, both given as
+/// containers with ConvParams::RowNum and ConvParams::ColNum entries.
+template <typename TInput, typename TWindowValueCont, typename TStrideValueCont,
+          typename = std::enable_if_t<IsValidOper<OpTags::MaxPool2D, RemConstRef<TInput>>>>
+auto MaxPool(TInput&& p_input, const TWindowValueCont& p_windowSize, const TStrideValueCont& p_strides)
+{
+    NSPool2D::Window window;
+    std::tie(window.m_rowNum, window.m_colNum) = NSPool2D::ReadParams(p_windowSize);
+    std::tie(window.m_strideRow, window.m_strideCol) = NSPool2D::ReadParams(p_strides);
+
+    using rawOp = RemConstRef<TInput>;
+    using ResType = Operator<OpTags::MaxPool2D, rawOp>;
+    using AuxType = OperAuxParams<OpTags::MaxPool2D, typename ResType::CategoryTag>;
+    return ResType(AuxType(window), std::forward<TInput>(p_input));
+}
+
+/// Average pooling, with the same parameters as MaxPool.
+template <typename TInput, typename TWindowValueCont, typename TStrideValueCont,
+          typename = std::enable_if_t<IsValidOper<OpTags::AvgPool2D, RemConstRef<TInput>>>>
+auto AvgPool(TInput&& p_input, const TWindowValueCont& p_windowSize, const TStrideValueCont& p_strides)
+{
+    NSPool2D::Window window;
+    std::tie(window.m_rowNum, window.m_colNum) = NSPool2D::ReadParams(p_windowSize);
+    std::tie(window.m_strideRow, window.m_strideCol) = NSPool2D::ReadParams(p_strides);
+
+    using rawOp = RemConstRef<TInput>;
+    using ResType = Operator<OpTags::AvgPool2D, rawOp>;
+    using AuxType = OperAuxParams<OpTags::AvgPool2D, typename ResType::CategoryTag>;
+    return ResType(AuxType(window), std::forward<TInput>(p_input));
+}
+}
+
+namespace MetaNN
+{
+template <typename TGrad, typename TInput>
+constexpr bool IsValidOper<OpTags::MaxPool2DGrad, TGrad, TInput> =
+    (IsThreeDArray<TGrad> && IsThreeDArray<TInput>) ||
+    (IsBatchThreeDArray<TGrad> && IsBatchThreeDArray<TInput>);
+
+template <typename TCate>
+class OperAuxParams<OpTags::MaxPool2DGrad, TCate> : public OperPool2DAuxParams<OpTags::MaxPool2DGrad, TCate>
+{
+public:
+    using OperPool2DAuxParams<OpTags::MaxPool2DGrad, TCate>::OperPool2DAuxParams;
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::MaxPool2DGrad, TCate>
+{
+public:
+    template <typename TGrad, typename TInput>
+    OperShapeInfo(const OperAuxParams<OpTags::MaxPool2DGrad, TCate>& auxParams,
+                  const TGrad& grad, const TInput& input)
+        : m_shape(input.Shape())
+    {
+        if (NSPool2D::OutShape(m_shape, auxParams) != grad.Shape())
+        {
+            throw std::runtime_error("MaxPool2DGrad error: gradient shape mismatch.");
+        }
+    }
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<TCate> m_shape;
+};
+
+namespace OperMaxPool2DGrad::NSCaseGen
+{
+    template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EvalItem(TGradHandle gradHandle, TInputHandle inputHandle,
+                 TOutputHandle outputHandle, const NSPool2D::Window& window)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {gradHandle.DataPtr(), inputHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_gradHandle(std::move(gradHandle))
+            , m_inputHandle(std::move(inputHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_window(window)
+        {}
+
+        const TGradHandle m_gradHandle;
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+        const NSPool2D::Window m_window;
+    };
+
+    // Every output gradient goes to the first maximal element of its window, the element
+    // the forward pass selected.
+    template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TGradHandle, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TGradHandle, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& grad = evalItem.m_gradHandle.Data();
+            const auto& in = evalItem.m_inputHandle.Data();
+            const auto& window = evalItem.m_window;
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(in.Shape());
+
+            const size_t h = in.Shape().RowNum();
+            const size_t w = in.Shape().ColNum();
+            const size_t oh = grad.Shape().RowNum();
+            const size_t ow = grad.Shape().ColNum();
+            const size_t planeNum = NSPool2D::PlaneNum(in.Shape());
+
+            auto low_grad = LowerAccess(grad);
+            const ElementType* mem_grad = low_grad.RawMemory();
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            NSPool2D::ForEachPlane(planeNum, grad.Shape().Count() * window.Size(),
+                                   [&](size_t plane)
+                                   {
+                                       const ElementType* planeIn = mem_in + plane * h * w;
+                                       const ElementType* planeGrad = mem_grad + plane * oh * ow;
+                                       ElementType* planeOut = mem_out + plane * h * w;
+                                       std::fill(planeOut, planeOut + h * w, ElementType{});
+                                       for (size_t oy = 0; oy < oh; ++oy)
+                                       {
+                                           for (size_t ox = 0; ox < ow; ++ox)
+                                           {
+                                               const size_t base = oy * window.m_strideRow * w + ox * window.m_strideCol;
+                                               size_t pos = base;
+                                               for (size_t i = 0; i < window.m_rowNum; ++i)
+                                               {
+                                                   for (size_t j = 0; j < window.m_colNum; ++j)
+                                                   {
+                                                       if (planeIn[base + i * w + j] > planeIn[pos])
+                                                       {
+                                                           pos = base + i * w + j;
+                                                       }
+                                                   }
+                                               }
+                                               planeOut[pos] += planeGrad[oy * ow + ox];
+                                           }
+                                       }
+                                   });
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+template <>
+struct OperSeq_<OpTags::MaxPool2DGrad>
+{
+    using type = OperCalAlgoChain<TailCalculator<OperMaxPool2DGrad::NSCaseGen::EvalItem,
+                                                 OperMaxPool2DGrad::NSCaseGen::EvalGroup>>;
+};
+
+/// Gradient of MaxPool with respect to its input. The maximal positions are located again
+/// from the input, window is the AuxParams() of the forward operator.
+template <typename TGrad, typename TInput,
+          typename = std::enable_if_t<IsValidOper<OpTags::MaxPool2DGrad, RemConstRef<TGrad>, RemConstRef<TInput>>>>
+auto MaxPoolGrad(TGrad&& p_grad, TInput&& p_input, const NSPool2D::Window& p_window)
+{
+    using ResType = Operator<OpTags::MaxPool2DGrad, RemConstRef<TGrad>, RemConstRef<TInput>>;
+    using AuxType = OperAuxParams<OpTags::MaxPool2DGrad, typename ResType::CategoryTag>;
+    return ResType(AuxType(p_window), std::forward<TGrad>(p_grad), std::forward<TInput>(p_input));
+}
+}
+
+namespace MetaNN
+{
+template <typename TGrad>
+constexpr bool IsValidOper<OpTags::AvgPool2DGrad, TGrad> = IsThreeDArray<TGrad> || IsBatchThreeDArray<TGrad>;
+
+template <typename TCate>
+class OperAuxParams<OpTags::AvgPool2DGrad, TCate> : public NSPool2D::Window
+{
+public:
+    OperAuxParams(const NSPool2D::Window& window, MetaNN::Shape<TCate> inputShape)
+        : NSPool2D::Window(window)
+        , m_inputShape(std::move(inputShape))
+    {}
+
+    bool operator == (const OperAuxParams& val) const
+    {
+        return NSPool2D::Window::operator==(val) &&
+               (m_inputShape == val.m_inputShape);
+    }
+
+    const MetaNN::Shape<TCate> m_inputShape;
+};
+
+template <typename TCate>
+class OperShapeInfo<OpTags::AvgPool2DGrad, TCate>
+{
+public:
+    template <typename TGrad>
+    OperShapeInfo(const OperAuxParams<OpTags::AvgPool2DGrad, TCate>& auxParams, const TGrad& grad)
+        : m_shape(auxParams.m_inputShape)
+    {
+        if (NSPool2D::OutShape(m_shape, auxParams) != grad.Shape())
+        {
+            throw std::runtime_error("AvgPool2DGrad error: gradient shape mismatch.");
+        }
+    }
+
+    const auto& Shape() const
+    {
+        return m_shape;
+    }
+
+private:
+    MetaNN::Shape<TCate> m_shape;
+};
+
+namespace OperAvgPool2DGrad::NSCaseGen
+{
+    template <typename TGradHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ShapeType = MetaNN::Shape<typename TOutputHandle::DataType::CategoryTag>;
+    public:
+        template <typename TAuxParams>
+        EvalItem(TGradHandle gradHandle, TOutputHandle outputHandle, const TAuxParams& auxParams)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {gradHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_gradHandle(std::move(gradHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_window(auxParams)
+            , m_inputShape(auxParams.m_inputShape)
+        {}
+
+        const TGradHandle m_gradHandle;
+        TOutputHandle m_outputHandle;
+        const NSPool2D::Window m_window;
+        const ShapeType m_inputShape;
+    };
+
+    // Every window receives its output gradient divided by the window size.
+    template <typename TGradHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TGradHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TGradHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& grad = evalItem.m_gradHandle.Data();
+            const auto& window = evalItem.m_window;
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_inputShape);
+
+            const size_t h = out.Shape().RowNum();
+            const size_t w = out.Shape().ColNum();
+            const size_t oh = grad.Shape().RowNum();
+            const size_t ow = grad.Shape().ColNum();
+            const size_t planeNum = NSPool2D::PlaneNum(out.Shape());
+            const ElementType scale = static_cast<ElementType>(1) / static_cast<ElementType>(window.Size());
+
+            auto low_grad = LowerAccess(grad);
+            const ElementType* mem_grad = low_grad.RawMemory();
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            NSPool2D::ForEachPlane(planeNum, grad.Shape().Count() * window.Size(),
+                                   [&](size_t plane)
+                                   {
+                                       const ElementType* planeGrad = mem_grad + plane * oh * ow;
+                                       ElementType* planeOut = mem_out + plane * h * w;
+                                       std::fill(planeOut, planeOut + h * w, ElementType{});
+
+                                       std::vector<ElementType> row(ow);
+                                       for (size_t oy = 0; oy < oh; ++oy)
+                                       {
+                                           for (size_t ox = 0; ox < ow; ++ox)
+                                           {
+                                               row[ox] = planeGrad[oy * ow + ox] * scale;
+                                           }
+                                           ElementType* dst = planeOut + oy * window.m_strideRow * w;
+                                           for (size_t i = 0; i < window.m_rowNum; ++i)
+                                           {
+                                               for (size_t j = 0; j < window.m_colNum; ++j)
+                                               {
+                                                   if (window.m_strideCol == 1)
+                                                   {
+                                                       NSPool2D::RowAccumulate<false>(row.data(), dst + i * w + j, ow);
+                                                   }
+                                                   else
+                                                   {
+                                                       for (size_t ox = 0; ox < ow; ++ox)
+                                                       {
+                                                           dst[i * w + ox * window.m_strideCol + j] += row[ox];
+                                                       }
+                                                   }
+                                               }
+                                           }
+                                       }
+                                   });
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+}
+
+template <>
+struct OperSeq_<OpTags::AvgPool2DGrad>
+{
+    using type = OperCalAlgoChain<TailCalculator<OperAvgPool2DGrad::NSCaseGen::EvalItem,
+                                                 OperAvgPool2DGrad::NSCaseGen::EvalGroup>>;
+};
+
+/// Gradient of AvgPool with respect to its input of shape inputShape.
+template <typename TGrad,
+          typename = std::enable_if_t<IsValidOper<OpTags::AvgPool2DGrad, RemConstRef<TGrad>>>>
+auto AvgPoolGrad(TGrad&& p_grad, const NSPool2D::Window& p_window,
+                 Shape<DataCategory<RemConstRef<TGrad>>> p_inputShape)
+{
+    using ResType = Operator<OpTags::AvgPool2DGrad, RemConstRef<TGrad>>;
+    using AuxType = OperAuxParams<OpTags::AvgPool2DGrad, typename ResType::CategoryTag>;
+    return ResType(AuxType(p_window, std::move(p_inputShape)), std::forward<TGrad>(p_grad));
+}
+}
@@ -2,6 +2,7 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
 #include <cassert>
 #include <type_traits>
@@ -13,6 +14,22 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperAbs
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in)
+        {
+            const T zero{};
+            out = (in > zero) ? in : -in;
+        }
+    };
+}
+
 namespace OperAbs::NSCaseGen
 {
     template <typename TInputHandle, typename TOutputHandle>
@@ -56,12 +73,7 @@ namespace OperAbs::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            const ElementType zero{};
-            for (size_t i = 0; i < count; ++i)
-            {
-                const ElementType val = mem_in[i];
-                mem_out[i] = (val > zero) ? val : -val;
-            }
+            NSElementwiseEngine::Map<OperAbs::Fun>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -2,6 +2,7 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <cassert>
 #include <cmath>
@@ -15,6 +16,21 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperAsin
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = false;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in)
+        {
+            out = std::asin(in);
+        }
+    };
+}
+
 namespace OperAsin::NSCaseGen
 {
     template <typename TInputHandle, typename TOutputHandle>
@@ -58,10 +74,7 @@ namespace OperAsin::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = std::asin(mem_in[i]);
-            }
+            NSElementwiseEngine::Map<OperAsin::Fun>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -85,6 +98,21 @@ auto Asin(TP&& p_m)
 
 namespace MetaNN
 {
+namespace OperAsinGrad
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = false;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& grad, const T& in)
+        {
+            out = grad / std::sqrt(1 - in * in);
+        }
+    };
+}
+
 namespace OperAsinGrad::NSCaseGen
 {
     template <typename TGradHandle, typename TInputHandle, typename TOutputHandle>
@@ -135,10 +163,7 @@ namespace OperAsinGrad::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_grad[i] / std::sqrt(1 - mem_in[i] * mem_in[i]);
-            }
+            NSElementwiseEngine::Map<OperAsinGrad::Fun>(mem_out, count, mem_grad, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -2,6 +2,11 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/elementwise/facilities/broadcast.h>
+#include <MetaNN/operators/elementwise/facilities/constant.h>
+#include <MetaNN/operators/elementwise/facilities/fixed_shape.h>
+#include <MetaNN/operators/elementwise/facilities/strided.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/instance_id.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
 #include <stdexcept>
@@ -64,10 +69,7 @@ namespace OperDivide::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in1[i] / mem_in2[i];
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Divide>(mem_out, count, mem_in1, mem_in2);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -76,7 +78,11 @@ namespace OperDivide::NSCaseGen
 template <>
 struct OperSeq_<OpTags::Divide>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperDivide::NSCaseGen::EvalItem, OperDivide::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<NSElementwiseConstant::Calculator<NSElementwiseEngine::Divide>,
+                                  NSElementwiseFixed::Calculator<NSElementwiseEngine::Divide>,
+                                  NSElementwiseStrided::Calculator<NSElementwiseEngine::Divide>,
+                                  NSElementwiseBroadcast::Calculator<NSElementwiseEngine::Divide>,
+                                  TailCalculator<OperDivide::NSCaseGen::EvalItem, OperDivide::NSCaseGen::EvalGroup>>;
 };
 
 /// Divide by number
@@ -125,10 +131,7 @@ namespace OperDivideByNum::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in[i] / evalItem.m_value;
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Divide>(mem_out, count, mem_in, static_cast<ElementType>(evalItem.m_value));
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
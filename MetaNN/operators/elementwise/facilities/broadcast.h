@@ -0,0 +1,175 @@
+#pragma once
+
+#include <MetaNN/data/facilities/shape.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/facilities/cont_metafuns/sequential.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
+#include <MetaNN/operators/facilities/operator_frame.h>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MetaNN::OpTags
+{
+    struct Duplicate;
+}
+
+namespace MetaNN::NSElementwiseBroadcast
+{
+    template <typename T>
+    constexpr bool IsBroadcast = false;
+
+    template <typename TOriData, typename TCategory>
+    constexpr bool IsBroadcast<Operator<OpTags::Duplicate, TOriData, Shape<TCategory>>> = true;
+
+    template <typename TOp>
+    constexpr bool HasBroadcast = false;
+
+    template <typename TOpTag, typename... TOperands>
+    constexpr bool HasBroadcast<Operator<TOpTag, TOperands...>> = (IsBroadcast<TOperands> || ...);
+
+    // A Duplicate operand registers its source, every other operand registers itself.
+    template <typename TOperand>
+    auto SourceEvalRegister(const TOperand& operand)
+    {
+        if constexpr (IsBroadcast<TOperand>)
+        {
+            return operand.Operand().EvalRegister();
+        }
+        else
+        {
+            return operand.EvalRegister();
+        }
+    }
+
+    template <typename TOperand>
+    size_t SourceCount(const TOperand& operand)
+    {
+        if constexpr (IsBroadcast<TOperand>)
+        {
+            return operand.Operand().Shape().Count();
+        }
+        else
+        {
+            return operand.Shape().Count();
+        }
+    }
+
+    template <typename TFun, typename TOutputHandle, typename... TInputHandles>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ShapeType = Shape<typename TOutputHandle::DataType::CategoryTag>;
+    public:
+        EvalItem(std::tuple<TInputHandles...> inputHandles, ShapeType shape, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       std::apply([](const auto&... handle) { return std::vector<const void*>{handle.DataPtr()...}; },
+                                  inputHandles),
+                       outputHandle.DataPtr())
+            , m_inputHandles(std::move(inputHandles))
+            , m_shape(std::move(shape))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const std::tuple<TInputHandles...> m_inputHandles;
+        const ShapeType m_shape;
+        TOutputHandle m_outputHandle;
+    };
+
+    // Scalar sources are used as a value, the others are repeated along the output.
+    template <typename TElem, typename TData>
+    auto EngineInput(const TData& data)
+    {
+        if constexpr (IsScalar<TData>)
+        {
+            return static_cast<TElem>(data.Value());
+        }
+        else
+        {
+            auto low = LowerAccess(data);
+            return NSElementwiseEngine::Broadcast<TElem>{low.RawMemory(), data.Shape().Count()};
+        }
+    }
+
+    template <typename TFun, typename TOutputHandle, typename... TInputHandles>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TFun, TOutputHandle, TInputHandles...>>
+    {
+        using EvalItemType = EvalItem<TFun, TOutputHandle, TInputHandles...>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(evalItem.m_shape);
+            const size_t count = out.Shape().Count();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            std::apply([mem_out, count](const auto&... handle)
+                       {
+                           NSElementwiseEngine::Map<TFun>(mem_out, count, EngineInput<ElementType>(handle.Data())...);
+                       }, evalItem.m_inputHandles);
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+/// Case calculator for elementwise operators: takes over when some operands are a Duplicate
+/// (e.g. a bias promoted to the batch shape) and reads their sources in place, repeated along
+/// the output, so the promoted copies are never materialised.
+template <typename TFun>
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using THead = Sequential::Head<TCaseTail>;
+        using TTail = Sequential::Tail<TCaseTail>;
+        if constexpr (!HasBroadcast<TOp>)
+        {
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            const auto& operands = oper.OperandTuple();
+            const size_t count = oper.Shape().Count();
+            const auto sourceCounts = std::apply([](const auto&... operand)
+                                                 {
+                                                     return std::array<size_t, sizeof...(operand)>{SourceCount(operand)...};
+                                                 }, operands);
+            for (size_t c : sourceCounts)
+            {
+                if ((c == 0) || (count % c != 0))
+                {
+                    THead::template EvalRegister<TTail>(evalRes, oper);
+                    return;
+                }
+            }
+
+            auto handles = std::apply([](const auto&... operand)
+                                      {
+                                          return std::make_tuple(SourceEvalRegister(operand)...);
+                                      }, operands);
+            auto outHandle = evalRes.Handle();
+            using TOutputHandle = decltype(outHandle);
+            using TDevice = DeviceTypeFromHandle<TOutputHandle>;
+
+            std::apply([&outHandle, &oper](auto&... handle)
+                       {
+                           using ItemType = EvalItem<TFun, TOutputHandle, RemConstRef<decltype(handle)>...>;
+                           using GroupType = EvalGroup<TFun, TOutputHandle, RemConstRef<decltype(handle)>...>;
+                           using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+                           auto item = std::make_unique<ItemType>(std::make_tuple(std::move(handle)...),
+                                                                  oper.Shape(), std::move(outHandle));
+                           EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+                       }, handles);
+        }
+    }
+};
+}
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/facilities/cont_metafuns/sequential.h>
+#include <MetaNN/operators/facilities/constant_operand.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
+#include <type_traits>
+
+namespace MetaNN::NSElementwiseConstant
+{
+    template <typename TFun, bool ConstFirst, typename TInputHandle, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+        using ElementType = typename TOutputHandle::DataType::ElementType;
+    public:
+        EvalItem(TInputHandle oriHandle, ElementType p_value, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {oriHandle.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle(std::move(oriHandle))
+            , m_value(p_value)
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle m_inputHandle;
+        const ElementType m_value;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TFun, bool ConstFirst, typename TInputHandle, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TFun, ConstFirst, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TFun, ConstFirst, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            ResType out(in.Shape());
+
+            const size_t count = in.Shape().Count();
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            if constexpr (ConstFirst)
+            {
+                NSElementwiseEngine::Map<TFun>(mem_out, count, evalItem.m_value, mem_in);
+            }
+            else
+            {
+                NSElementwiseEngine::Map<TFun>(mem_out, count, mem_in, evalItem.m_value);
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    // x + 0 and x - 0: the result shares the buffer of x.
+    template <typename TInputHandle, typename TOutputHandle>
+    class ForwardEvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        ForwardEvalItem(TInputHandle oriHandle, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(ForwardEvalItem)),
+                       {oriHandle.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle(std::move(oriHandle))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TInputHandle, typename TOutputHandle>
+    class ForwardEvalGroup : public TrivalEvalGroup<ForwardEvalItem<TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = ForwardEvalItem<TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            evalItem.m_outputHandle.SetData(evalItem.m_inputHandle.Data());
+        }
+    };
+
+/// Case calculator for binary elementwise operators: takes over when exactly one operand is
+/// a constant (TrivalMatrix, ZeroData), applying its value as a scalar so the constant is
+/// never materialised. Adding or subtracting ZeroData forwards the other operand.
+template <typename TFun>
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (IsConstantOperand<TOperand0> == IsConstantOperand<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            constexpr bool constFirst = IsConstantOperand<TOperand0>;
+            const auto& constOperand = oper.template Operand<constFirst ? 0 : 1>();
+            auto handle = oper.template Operand<constFirst ? 1 : 0>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+            using TInputHandle = decltype(handle);
+            using TOutputHandle = decltype(outHandle);
+
+            constexpr bool isForward = IsZeroData<RemConstRef<decltype(constOperand)>> &&
+                                       (std::is_same_v<TFun, NSElementwiseEngine::Add> ||
+                                        (std::is_same_v<TFun, NSElementwiseEngine::Substract> && !constFirst)) &&
+                                       std::is_same_v<typename TInputHandle::DataType, typename TOutputHandle::DataType>;
+            if constexpr (isForward)
+            {
+                using ItemType = ForwardEvalItem<TInputHandle, TOutputHandle>;
+                using GroupType = ForwardEvalGroup<TInputHandle, TOutputHandle>;
+                using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+                auto item = std::make_unique<ItemType>(std::move(handle), std::move(outHandle));
+                EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+            }
+            else
+            {
+                using ItemType = EvalItem<TFun, constFirst, TInputHandle, TOutputHandle>;
+                using GroupType = EvalGroup<TFun, constFirst, TInputHandle, TOutputHandle>;
+                using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+                auto item = std::make_unique<ItemType>(std::move(handle), ConstantOperandValue(constOperand),
+                                                       std::move(outHandle));
+                EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+            }
+        }
+    }
+};
+}
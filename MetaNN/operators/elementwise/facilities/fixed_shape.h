@@ -0,0 +1,97 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/fixed_matrix.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/facilities/cont_metafuns/sequential.h>
+#include <type_traits>
+
+namespace MetaNN::NSElementwiseFixed
+{
+    template <typename TFun, typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EvalItem(TInputHandle1 oriHandle1, TInputHandle2 oriHandle2, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {oriHandle1.DataPtr(), oriHandle2.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle1(std::move(oriHandle1))
+            , m_inputHandle2(std::move(oriHandle2))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_inputHandle1;
+        const TInputHandle2 m_inputHandle2;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TFun, typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TFun, TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TFun, TInputHandle1, TInputHandle2, TOutputHandle>;
+        using TData1 = typename TInputHandle1::DataType;
+        constexpr static size_t Count = TData1::FixedRowNum * TData1::FixedColNum;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_inputHandle1.Data();
+            const auto& in2 = evalItem.m_inputHandle2.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            static_assert(IsMatrix<ResType>);
+            ResType out(in1.Shape());
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* __restrict mem_in1 = low_in1.RawMemory();
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* __restrict mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* __restrict mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            // the trip count is a compile-time constant, so the loop is unrolled and vectorized.
+            for (size_t i = 0; i < Count; ++i)
+            {
+                TFun::Apply(mem_out[i], mem_in1[i], mem_in2[i]);
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+/// Case calculator for binary elementwise operators: takes over when both operands
+/// are FixedMatrix, otherwise passes to the next calculator.
+template <typename TFun>
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsFixedMatrix<TOperand0> || !std::is_same_v<TOperand0, TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = MakeConstEvalHandle(oper.template Operand<0>());
+            auto handle2 = MakeConstEvalHandle(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<TFun, decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<TFun, decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2), std::move(outHandle));
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
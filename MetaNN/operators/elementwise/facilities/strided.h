@@ -0,0 +1,105 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/matrix_view.h>
+#include <MetaNN/data/facilities/traits.h>
+#include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/facilities/cont_metafuns/sequential.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
+#include <cassert>
+#include <type_traits>
+
+namespace MetaNN::NSElementwiseStrided
+{
+    template <typename TFun, typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalItem : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EvalItem(TInputHandle1 oriHandle1, TInputHandle2 oriHandle2, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EvalItem)),
+                       {oriHandle1.DataPtr(), oriHandle2.DataPtr()}, outputHandle.DataPtr())
+            , m_inputHandle1(std::move(oriHandle1))
+            , m_inputHandle2(std::move(oriHandle2))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TInputHandle1 m_inputHandle1;
+        const TInputHandle2 m_inputHandle2;
+        TOutputHandle m_outputHandle;
+    };
+
+    template <typename TFun, typename TInputHandle1, typename TInputHandle2, typename TOutputHandle>
+    class EvalGroup : public TrivalEvalGroup<EvalItem<TFun, TInputHandle1, TInputHandle2, TOutputHandle>>
+    {
+        using EvalItemType = EvalItem<TFun, TInputHandle1, TInputHandle2, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in1 = evalItem.m_inputHandle1.Data();
+            const auto& in2 = evalItem.m_inputHandle2.Data();
+            assert(in1.Shape() == in2.Shape());
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            static_assert(IsMatrix<ResType>);
+            ResType out(in1.Shape());
+
+            const size_t rowNum = in1.Shape().RowNum();
+            const size_t colNum = in1.Shape().ColNum();
+            const size_t ld1 = RowStride(in1);
+            const size_t ld2 = RowStride(in2);
+
+            auto low_in1 = LowerAccess(in1);
+            const ElementType* mem_in1 = low_in1.RawMemory();
+            auto low_in2 = LowerAccess(in2);
+            const ElementType* mem_in2 = low_in2.RawMemory();
+
+            auto low_out = LowerAccess(out);
+            ElementType* mem_out = low_out.MutableRawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            for (size_t i = 0; i < rowNum; ++i)
+            {
+                NSElementwiseEngine::Map<TFun>(mem_out, colNum, mem_in1, mem_in2);
+                mem_out += colNum;
+                mem_in1 += ld1;
+                mem_in2 += ld2;
+            }
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+/// Case calculator for binary elementwise operators: takes over when any operand
+/// is a MatrixView and reads it in place, otherwise passes to the next calculator.
+template <typename TFun>
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsMatrixView<TOperand0> && !IsMatrixView<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            auto handle1 = StridedEvalRegister(oper.template Operand<0>());
+            auto handle2 = StridedEvalRegister(oper.template Operand<1>());
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            using ItemType = EvalItem<TFun, decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using GroupType = EvalGroup<TFun, decltype(handle1), decltype(handle2), decltype(outHandle)>;
+            using DispatcherType = TrivalEvalItemDispatcher<GroupType>;
+
+            auto item = std::make_unique<ItemType>(std::move(handle1), std::move(handle2), std::move(outHandle));
+            EvalPlan<TDevice>::Inst().template Register<DispatcherType>(std::move(item));
+        }
+    }
+};
+}
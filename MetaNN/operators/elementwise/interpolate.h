@@ -2,6 +2,8 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/elementwise/facilities/broadcast.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
 #include <stdexcept>
 
@@ -12,6 +14,21 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperInterpolate
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in1, const T& in2, const T& in3)
+        {
+            out = in1 * in3 + in2 * (1 - in3);
+        }
+    };
+}
+
 namespace OperInterpolate::NSCaseGen
 {
     template <typename TInputHandle1, typename TInputHandle2, typename TInputHandle3,
@@ -71,10 +88,7 @@ namespace OperInterpolate::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in1[i] * mem_in3[i] + mem_in2[i] * (1 - mem_in3[i]);
-            }
+            NSElementwiseEngine::Map<OperInterpolate::Fun>(mem_out, count, mem_in1, mem_in2, mem_in3);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -83,7 +97,8 @@ namespace OperInterpolate::NSCaseGen
 template <>
 struct OperSeq_<OpTags::Interpolate>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperInterpolate::NSCaseGen::EvalItem, OperInterpolate::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<NSElementwiseBroadcast::Calculator<OperInterpolate::Fun>,
+                                  TailCalculator<OperInterpolate::NSCaseGen::EvalItem, OperInterpolate::NSCaseGen::EvalGroup>>;
 };
 
 template <typename TP1, typename TP2, typename TP3,
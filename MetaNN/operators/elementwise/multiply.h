@@ -2,6 +2,11 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/elementwise/facilities/broadcast.h>
+#include <MetaNN/operators/elementwise/facilities/constant.h>
+#include <MetaNN/operators/elementwise/facilities/fixed_shape.h>
+#include <MetaNN/operators/elementwise/facilities/strided.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <stdexcept>
 
@@ -62,10 +67,7 @@ namespace OperatorMultiply::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in1[i] * mem_in2[i];
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Multiply>(mem_out, count, mem_in1, mem_in2);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -74,7 +76,11 @@ namespace OperatorMultiply::NSCaseGen
 template <>
 struct OperSeq_<OpTags::Multiply>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperatorMultiply::NSCaseGen::EvalItem, OperatorMultiply::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<NSElementwiseConstant::Calculator<NSElementwiseEngine::Multiply>,
+                                  NSElementwiseFixed::Calculator<NSElementwiseEngine::Multiply>,
+                                  NSElementwiseStrided::Calculator<NSElementwiseEngine::Multiply>,
+                                  NSElementwiseBroadcast::Calculator<NSElementwiseEngine::Multiply>,
+                                  TailCalculator<OperatorMultiply::NSCaseGen::EvalItem, OperatorMultiply::NSCaseGen::EvalGroup>>;
 };
 
 // multiply with number
@@ -142,10 +148,7 @@ namespace NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in[i] * evalItem.m_value;
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Multiply>(mem_out, count, mem_in, static_cast<ElementType>(evalItem.m_value));
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
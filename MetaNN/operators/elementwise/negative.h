@@ -2,6 +2,7 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
 #include <cassert>
 #include <type_traits>
@@ -13,6 +14,21 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperNegative
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in)
+        {
+            out = -in;
+        }
+    };
+}
+
 namespace OperNegative::NSCaseGen
 {
     template <typename TInputHandle, typename TOutputHandle>
@@ -56,10 +72,7 @@ namespace OperNegative::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = -mem_in[i];
-            }
+            NSElementwiseEngine::Map<OperNegative::Fun>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -2,6 +2,7 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <cassert>
 #include <type_traits>
@@ -13,6 +14,24 @@ namespace MetaNN::OpTags
 
 namespace MetaNN
 {
+namespace OperSign
+{
+    struct Fun
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in)
+        {
+            const T zero{};
+            const T one = zero + 1;
+            const T negOne = zero - 1;
+            out = (in == zero) ? zero : ((in > zero) ? one : negOne);
+        }
+    };
+}
+
 namespace OperSign::NSCaseGen
 {
     template <typename TInputHandle, typename TOutputHandle>
@@ -56,16 +75,7 @@ namespace OperSign::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            const ElementType zero{};
-            const ElementType one{1};
-            const ElementType negOne{-1};
-            for (size_t i = 0; i < count; ++i)
-            {
-                if (mem_in[i] == zero)
-                    mem_out[i] = zero;
-                else
-                    mem_out[i] = (mem_in[i] > zero) ? one : negOne;
-            }
+            NSElementwiseEngine::Map<OperSign::Fun>(mem_out, count, mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
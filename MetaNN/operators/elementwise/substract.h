@@ -2,6 +2,11 @@
 
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
+#include <MetaNN/operators/elementwise/facilities/broadcast.h>
+#include <MetaNN/operators/elementwise/facilities/constant.h>
+#include <MetaNN/operators/elementwise/facilities/fixed_shape.h>
+#include <MetaNN/operators/elementwise/facilities/strided.h>
+#include <MetaNN/operators/facilities/elementwise_engine.h>
 #include <MetaNN/operators/facilities/operator_frame.h>
 #include <stdexcept>
 
@@ -62,10 +67,7 @@ namespace OperSubstract::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = mem_in1[i] - mem_in2[i];
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Substract>(mem_out, count, mem_in1, mem_in2);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
@@ -74,7 +76,11 @@ namespace OperSubstract::NSCaseGen
 template <>
 struct OperSeq_<OpTags::Substract>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperSubstract::NSCaseGen::EvalItem, OperSubstract::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<NSElementwiseConstant::Calculator<NSElementwiseEngine::Substract>,
+                                  NSElementwiseFixed::Calculator<NSElementwiseEngine::Substract>,
+                                  NSElementwiseStrided::Calculator<NSElementwiseEngine::Substract>,
+                                  NSElementwiseBroadcast::Calculator<NSElementwiseEngine::Substract>,
+                                  TailCalculator<OperSubstract::NSCaseGen::EvalItem, OperSubstract::NSCaseGen::EvalGroup>>;
 };
 
 /// Substract from number
@@ -138,10 +144,7 @@ namespace NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
-            for (size_t i = 0; i < count; ++i)
-            {
-                mem_out[i] = evalItem.m_minuend - mem_in[i];
-            }
+            NSElementwiseEngine::Map<NSElementwiseEngine::Substract>(mem_out, count, static_cast<ElementType>(evalItem.m_minuend), mem_in);
             evalItem.m_outputHandle.SetData(std::move(out));
         }
     };
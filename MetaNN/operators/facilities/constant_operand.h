@@ -0,0 +1,28 @@
+#pragma once
+
+#include <MetaNN/data/cardinal/matrix/trival_matrix.h>
+#include <MetaNN/data/general/zero_data.h>
+#include <MetaNN/facilities/traits.h>
+
+namespace MetaNN
+{
+/// Operands that broadcast one value over their shape. Kernels recognising them read the
+/// value as a scalar instead of evaluating the operand into a buffer.
+template <typename T>
+constexpr bool IsConstantOperand = IsTrivalMatrix<RemConstRef<T>> || IsZeroData<RemConstRef<T>>;
+
+template <typename T>
+auto ConstantOperandValue(const T& data)
+{
+    static_assert(IsConstantOperand<T>);
+    using ElementType = typename T::ElementType;
+    if constexpr (IsTrivalMatrix<T>)
+    {
+        return static_cast<ElementType>(data.ElementValue().Value());
+    }
+    else
+    {
+        return ElementType{};
+    }
+}
+}
@@ -0,0 +1,316 @@
+#pragma once
+
+#include <MetaNN/data/facilities/low_precision.h>
+#include <MetaNN/facilities/simd.h>
+#include <MetaNN/facilities/thread_pool.h>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Shared loop of the elementwise operators and activations: out[i] = TOp(in1[i], in2[i], ...).
+// TOp is a struct with a static Apply(out, ins...) template that is instantiated for elements
+// and, when TOp::IsVectorised<TElem> holds, for SimdVec of them. Apply writes its result
+// through a reference and is always inlined, so vectors never cross a call boundary.
+// An input is a contiguous array (const TElem*), an array repeated along the output
+// (Broadcast<TElem>) or a single value used for every element (TElem).
+// float and double loops are vectorised per SimdLevel, the tail is padded to a full vector so
+// that every element goes through the same code. Other element types are computed in their
+// ComputeType. Large outputs are split over ThreadPool; the result does not depend on the split.
+namespace MetaNN::NSElementwiseEngine
+{
+    template <typename TElem>
+    struct Broadcast
+    {
+        const TElem* m_mem;
+        size_t m_count;
+    };
+
+    template <typename TOp, typename TElem>
+    constexpr bool IsVectorised =
+#if defined(__GNUC__) || defined(__clang__)
+        (std::is_same_v<TElem, float> || std::is_same_v<TElem, double>) && TOp::template IsVectorised<TElem>;
+#else
+        false;
+#endif
+
+    /// true for the SimdVec instantiations of an Apply.
+    template <typename T, typename = void>
+    constexpr bool IsSimdVec = false;
+
+    template <typename T>
+    constexpr bool IsSimdVec<T, std::void_t<decltype(std::declval<T&>()[0])>> =
+        !std::is_class_v<T> && !std::is_pointer_v<T> && !std::is_array_v<T>;
+
+    // Outputs with fewer elements run on the calling thread only.
+    constexpr size_t ParallelThreshold = 1 << 16;
+    constexpr size_t MinChunk = 1 << 14;
+
+    // kernel arguments: Broadcast inputs are passed as contiguous pieces.
+    template <typename TElem, typename TInput>
+    struct KernelArg_
+    {
+        using type = const TElem*;
+    };
+
+    template <typename TElem>
+    struct KernelArg_<TElem, TElem>
+    {
+        using type = TElem;
+    };
+
+    template <typename TElem, typename TInput>
+    using KernelArg = typename KernelArg_<TElem, std::decay_t<TInput>>::type;
+
+    template <typename TElem, typename TInput>
+    KernelArg<TElem, TInput> Offset(const TInput& in, size_t pos)
+    {
+        if constexpr (std::is_same_v<TInput, Broadcast<TElem>>)
+        {
+            return in.m_mem + pos % in.m_count;
+        }
+        else if constexpr (std::is_same_v<TInput, TElem>)
+        {
+            return in;
+        }
+        else
+        {
+            return in + pos;
+        }
+    }
+
+    // elements from pos on that can be read contiguously.
+    template <typename TElem, typename TInput>
+    size_t Remain(const TInput& in, size_t pos)
+    {
+        if constexpr (std::is_same_v<TInput, Broadcast<TElem>>)
+        {
+            return in.m_count - pos % in.m_count;
+        }
+        else
+        {
+            return std::numeric_limits<size_t>::max();
+        }
+    }
+
+    template <typename TElem>
+    ComputeType<TElem> At(const TElem* in, size_t i)
+    {
+        return in[i];
+    }
+
+    template <typename TElem>
+    ComputeType<TElem> At(TElem in, size_t)
+    {
+        return in;
+    }
+
+    template <typename TOp, typename TElem, typename... TArgs>
+    void MapScalar(TElem* out, size_t count, TArgs... args)
+    {
+        for (size_t i = 0; i < count; ++i)
+        {
+            ComputeType<TElem> res;
+            TOp::Apply(res, At<TElem>(args, i)...);
+            out[i] = static_cast<TElem>(res);
+        }
+    }
+
+#if defined(__GNUC__) || defined(__clang__)
+    template <typename TVec, typename TElem>
+    METANN_ALWAYS_INLINE void Load(TVec& vec, const TElem* in, size_t len)
+    {
+        if (len * sizeof(TElem) != sizeof(TVec))
+        {
+            vec = TVec{};
+        }
+        std::memcpy(&vec, in, len * sizeof(TElem));
+    }
+
+    template <typename TVec, typename TElem>
+    METANN_ALWAYS_INLINE void Load(TVec& vec, TElem in, size_t)
+    {
+        vec = TVec{} + in;
+    }
+
+    template <typename TElem>
+    METANN_ALWAYS_INLINE const TElem* Advance(const TElem* in, size_t len)
+    {
+        return in + len;
+    }
+
+    template <typename TElem>
+    METANN_ALWAYS_INLINE TElem Advance(TElem in, size_t)
+    {
+        return in;
+    }
+
+    // out[0, len) for len <= the vector width.
+    template <typename TOp, size_t Bytes, typename TElem, size_t... Index, typename... TArgs>
+    METANN_ALWAYS_INLINE void Step(TElem* out, size_t len, std::index_sequence<Index...>, TArgs... args)
+    {
+        using TVec = SimdVec<TElem, Bytes>;
+        TVec ins[sizeof...(TArgs)];
+        (Load<TVec, TElem>(ins[Index], args, len), ...);
+        TVec res;
+        TOp::Apply(res, ins[Index]...);
+        std::memcpy(out, &res, len * sizeof(TElem));
+    }
+
+    template <typename TOp, size_t Bytes, typename TElem, typename... TArgs>
+    METANN_ALWAYS_INLINE void MapBody(TElem* out, size_t count, TArgs... args)
+    {
+        constexpr size_t Lanes = Bytes / sizeof(TElem);
+        constexpr auto Indexes = std::index_sequence_for<TArgs...>{};
+
+        size_t i = 0;
+        for (; i + 2 * Lanes <= count; i += 2 * Lanes)
+        {
+            Step<TOp, Bytes>(out + i, Lanes, Indexes, Advance<TElem>(args, i)...);
+            Step<TOp, Bytes>(out + i + Lanes, Lanes, Indexes, Advance<TElem>(args, i + Lanes)...);
+        }
+        for (; i < count; i += Lanes)
+        {
+            Step<TOp, Bytes>(out + i, std::min(Lanes, count - i), Indexes, Advance<TElem>(args, i)...);
+        }
+    }
+
+    template <typename TOp, typename TElem, typename... TArgs>
+    void MapGeneric(TElem* out, size_t count, TArgs... args)
+    {
+        MapBody<TOp, 16>(out, count, args...);
+    }
+
+#ifdef METANN_X86_DISPATCH
+    template <typename TOp, typename TElem, typename... TArgs>
+    __attribute__((target("avx2,fma")))
+    void MapAvx2(TElem* out, size_t count, TArgs... args)
+    {
+        MapBody<TOp, 32>(out, count, args...);
+    }
+
+    template <typename TOp, typename TElem, typename... TArgs>
+    __attribute__((target("avx512f")))
+    void MapAvx512(TElem* out, size_t count, TArgs... args)
+    {
+        MapBody<TOp, 64>(out, count, args...);
+    }
+#endif
+
+    template <typename TElem, typename... TArgs>
+    using MapType = void(*)(TElem*, size_t, TArgs...);
+
+    template <typename TOp, typename TElem, typename... TArgs>
+    MapType<TElem, TArgs...> SelectMap()
+    {
+#ifdef METANN_X86_DISPATCH
+        switch (CpuSimdLevel())
+        {
+        case SimdLevel::Avx512:
+            return &MapAvx512<TOp, TElem, TArgs...>;
+        case SimdLevel::Avx2:
+            return &MapAvx2<TOp, TElem, TArgs...>;
+        default:
+            break;
+        }
+#endif
+        return &MapGeneric<TOp, TElem, TArgs...>;
+    }
+#endif
+
+    template <typename TOp, typename TElem, typename... TArgs>
+    void MapContiguous(TElem* out, size_t count, TArgs... args)
+    {
+        if constexpr (IsVectorised<TOp, TElem>)
+        {
+            static const MapType<TElem, TArgs...> map = SelectMap<TOp, TElem, TArgs...>();
+            map(out, count, args...);
+        }
+        else
+        {
+            MapScalar<TOp>(out, count, args...);
+        }
+    }
+
+    template <typename TOp, typename TElem, typename... TInputs>
+    void MapRange(TElem* out, size_t beg, size_t end, const TInputs&... ins)
+    {
+        while (beg < end)
+        {
+            const size_t len = std::min({end - beg, Remain<TElem>(ins, beg)...});
+            MapContiguous<TOp, TElem, KernelArg<TElem, TInputs>...>(out + beg, len, Offset<TElem>(ins, beg)...);
+            beg += len;
+        }
+    }
+
+    /// out[i] = TOp(ins[i]...) for i < count; out may be one of the inputs.
+    template <typename TOp, typename TElem, typename... TInputs>
+    void Map(TElem* out, size_t count, const TInputs&... ins)
+    {
+        ThreadPool& pool = ThreadPool::Inst();
+        const size_t threadNum = pool.ThreadNum();
+        if ((threadNum <= 1) || (count < ParallelThreshold))
+        {
+            MapRange<TOp>(out, 0, count, ins...);
+            return;
+        }
+
+        const size_t taskNum = std::min(threadNum, count / MinChunk);
+        const size_t chunk = ((count + taskNum - 1) / taskNum + 63) / 64 * 64;
+        pool.ParallelFor((count + chunk - 1) / chunk,
+                         [&](size_t task)
+                         {
+                             const size_t beg = task * chunk;
+                             MapRange<TOp>(out, beg, std::min(count, beg + chunk), ins...);
+                         });
+    }
+
+    struct Add
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in1, const T& in2)
+        {
+            out = in1 + in2;
+        }
+    };
+
+    struct Substract
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in1, const T& in2)
+        {
+            out = in1 - in2;
+        }
+    };
+
+    struct Multiply
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in1, const T& in2)
+        {
+            out = in1 * in2;
+        }
+    };
+
+    struct Divide
+    {
+        template <typename TElem>
+        constexpr static bool IsVectorised = true;
+
+        template <typename T>
+        METANN_ALWAYS_INLINE static void Apply(T& out, const T& in1, const T& in2)
+        {
+            out = in1 / in2;
+        }
+    };
+}
@@ -1,17 +1,25 @@
 #pragma once
 
+#include <MetaNN/data/batch/batch_one_hot_vector.h>
+#include <MetaNN/data/facilities/low_precision.h>
 #include <MetaNN/data/facilities/traits.h>
 #include <MetaNN/evaluate/eval_plan.h>
 #include <MetaNN/operators/facilities/tail_calculator.h>
+#include <MetaNN/operators/facilities/vec_math.h>
 #include <MetaNN/operators/loss/facilities/organizer.h>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <type_traits>
+#include <vector>
 
 namespace MetaNN::OpTags
 {
     struct NLLLoss;
     struct NLLLossGrad;
+
+    // optimization assistant tags
+    struct Softmax;
 }
 
 namespace MetaNN
@@ -64,10 +72,18 @@ namespace OperNLLLoss::NSCaseGen
 
             static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
 
+            // log is taken a block at a time so that the vectorised kernel sees whole arrays.
+            constexpr size_t blockSize = 256;
+            ElementType logBuf[blockSize];
             ElementType res{};
-            for (size_t i = 0; i < inCount; ++i)
+            for (size_t base = 0; base < inCount; base += blockSize)
             {
-                res -= mem_weight[i] * log(mem_in[i]);
+                const size_t len = std::min(blockSize, inCount - base);
+                NSVecMath::Log(mem_in + base, logBuf, len);
+                for (size_t i = 0; i < len; ++i)
+                {
+                    res -= mem_weight[base + i] * logBuf[i];
+                }
             }
         
             if constexpr (!IsCardinal<decltype(weight)>)
@@ -82,6 +98,225 @@ namespace OperNLLLoss::NSCaseGen
     };
 }
 
+namespace OperNLLLoss::NSCaseSoftmax
+{
+    template <typename T>
+    constexpr bool IsSoftmax = false;
+
+    template <typename TOperand>
+    constexpr bool IsSoftmax<Operator<OpTags::Softmax, TOperand>> = true;
+
+    // log(sum(exp(x))) of one softmax matrix, shifted by the maximum for stability.
+    template <typename TElem>
+    ComputeType<TElem> LogSumExp(const TElem* in, size_t len)
+    {
+        using AccType = ComputeType<TElem>;
+        const AccType maxElem = *std::max_element(in, in + len);
+
+        constexpr size_t blockSize = 256;
+        AccType expBuf[blockSize];
+        AccType sum{};
+        for (size_t base = 0; base < len; base += blockSize)
+        {
+            const size_t blockLen = std::min(blockSize, len - base);
+            for (size_t i = 0; i < blockLen; ++i)
+            {
+                expBuf[i] = static_cast<AccType>(in[base + i]) - maxElem;
+            }
+            NSVecMath::Exp(expBuf, expBuf, blockLen);
+            for (size_t i = 0; i < blockLen; ++i)
+            {
+                sum += expBuf[i];
+            }
+        }
+        return maxElem + static_cast<AccType>(log(sum));
+    }
+
+    template <typename TWeightHandle, typename TInputHandle, typename TOutputHandle>
+    class EiGenWeight : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EiGenWeight(TWeightHandle weightHandle, TInputHandle inputHandle, TOutputHandle outputHandle)
+            : BaseType(std::type_index(typeid(EiGenWeight)),
+                       {weightHandle.DataPtr(), inputHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_weightHandle(std::move(weightHandle))
+            , m_inputHandle(std::move(inputHandle))
+            , m_outputHandle(std::move(outputHandle))
+        {}
+
+        const TWeightHandle m_weightHandle;
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+    };
+
+    // -sum(w * log(softmax(x))) = sum(w) * logsumexp(x) - sum(w * x) for each softmax matrix.
+    template <typename TWeightHandle, typename TInputHandle, typename TOutputHandle>
+    class EgGenWeight : public TrivalEvalGroup<EiGenWeight<TWeightHandle, TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EiGenWeight<TWeightHandle, TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& weight = evalItem.m_weightHandle.Data();
+            const auto& in = evalItem.m_inputHandle.Data();
+            assert(weight.Shape() == in.Shape());
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+
+            const size_t matrixSize = in.Shape().RowNum() * in.Shape().ColNum();
+            const size_t loopCount = in.Shape().Count() / matrixSize;
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+            auto low_weight = LowerAccess(weight);
+            const ElementType* mem_weight = low_weight.RawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            AccType res{};
+            for (size_t loop = 0; loop < loopCount; ++loop)
+            {
+                AccType weightSum{};
+                AccType weightedIn{};
+                for (size_t i = 0; i < matrixSize; ++i)
+                {
+                    weightSum += mem_weight[i];
+                    weightedIn += static_cast<AccType>(mem_weight[i]) * static_cast<AccType>(mem_in[i]);
+                }
+                if (weightSum != AccType{})
+                {
+                    res += weightSum * LogSumExp(mem_in, matrixSize);
+                }
+                res -= weightedIn;
+                mem_in += matrixSize;
+                mem_weight += matrixSize;
+            }
+
+            ResType out;
+            out.SetValue(static_cast<ElementType>(res / static_cast<AccType>(loopCount)));
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+    template <typename TInputHandle, typename TOutputHandle>
+    class EiOneHotWeight : public BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>
+    {
+        using BaseType = BaseEvalItem<DeviceTypeFromHandle<TOutputHandle>>;
+    public:
+        EiOneHotWeight(TInputHandle inputHandle, TOutputHandle outputHandle, std::vector<size_t> hotPos)
+            : BaseType(std::type_index(typeid(EiOneHotWeight)),
+                       {inputHandle.DataPtr()},
+                       outputHandle.DataPtr())
+            , m_inputHandle(std::move(inputHandle))
+            , m_outputHandle(std::move(outputHandle))
+            , m_hotPos(std::move(hotPos))
+        {}
+
+        const TInputHandle m_inputHandle;
+        TOutputHandle m_outputHandle;
+        const std::vector<size_t> m_hotPos;
+    };
+
+    // one-hot targets: the loss of each sample is logsumexp(x) - x[hot], a single log.
+    template <typename TInputHandle, typename TOutputHandle>
+    class EgOneHotWeight : public TrivalEvalGroup<EiOneHotWeight<TInputHandle, TOutputHandle>>
+    {
+        using EvalItemType = EiOneHotWeight<TInputHandle, TOutputHandle>;
+    protected:
+        virtual void EvalInternalLogic(EvalItemType& evalItem) final override
+        {
+            const auto& in = evalItem.m_inputHandle.Data();
+
+            using ResType = typename TOutputHandle::DataType;
+            using ElementType = typename ResType::ElementType;
+            using AccType = ComputeType<ElementType>;
+
+            const size_t matrixSize = in.Shape().RowNum() * in.Shape().ColNum();
+            const size_t loopCount = in.Shape().Count() / matrixSize;
+            assert(loopCount == evalItem.m_hotPos.size());
+
+            auto low_in = LowerAccess(in);
+            const ElementType* mem_in = low_in.RawMemory();
+
+            static_assert(std::is_same_v<DeviceTypeFromHandle<TOutputHandle>, DeviceTags::CPU>, "Currently only CPU is supported");
+
+            AccType res{};
+            for (size_t loop = 0; loop < loopCount; ++loop)
+            {
+                assert(evalItem.m_hotPos[loop] < matrixSize);
+                res += LogSumExp(mem_in, matrixSize) - static_cast<AccType>(mem_in[evalItem.m_hotPos[loop]]);
+                mem_in += matrixSize;
+            }
+
+            ResType out;
+            out.SetValue(static_cast<ElementType>(res / static_cast<AccType>(loopCount)));
+            evalItem.m_outputHandle.SetData(std::move(out));
+        }
+    };
+
+/// NLLLoss of a Softmax: computes the cross entropy from the softmax input with one
+/// log-sum-exp per sample, instead of writing the softmax output and taking a log per element.
+struct Calculator
+{
+    template <typename TCaseTail, typename TEvalRes, typename TOp>
+    static void EvalRegister(TEvalRes& evalRes, const TOp& oper)
+    {
+        using TOperand0 = RemConstRef<decltype(oper.template Operand<0>())>;
+        using TOperand1 = RemConstRef<decltype(oper.template Operand<1>())>;
+        if constexpr (!IsSoftmax<TOperand1>)
+        {
+            using THead = Sequential::Head<TCaseTail>;
+            using TTail = Sequential::Tail<TCaseTail>;
+            THead::template EvalRegister<TTail>(evalRes, oper);
+        }
+        else
+        {
+            const auto& operWeight = oper.template Operand<0>();
+            auto inHandle = oper.template Operand<1>().template Operand<0>().EvalRegister();
+            auto outHandle = evalRes.Handle();
+            using TDevice = DeviceTypeFromHandle<decltype(outHandle)>;
+
+            if constexpr (IsOneHot<TOperand0>)
+            {
+                std::vector<size_t> hotPos;
+                if constexpr (IsMatrix<TOperand0>)
+                {
+                    hotPos.push_back(operWeight.HotPos());
+                }
+                else
+                {
+                    for (size_t i = 0; i < operWeight.Shape().BatchNum(); ++i)
+                    {
+                        hotPos.push_back(operWeight.HotPos(i));
+                    }
+                }
+
+                using EvalItem = EiOneHotWeight<decltype(inHandle), decltype(outHandle)>;
+                using EvalGroup = EgOneHotWeight<decltype(inHandle), decltype(outHandle)>;
+                using EvalDispatcher = TrivalEvalItemDispatcher<EvalGroup>;
+
+                auto item = std::make_unique<EvalItem>(std::move(inHandle), std::move(outHandle), std::move(hotPos));
+                EvalPlan<TDevice>::Inst().template Register<EvalDispatcher>(std::move(item));
+            }
+            else
+            {
+                auto weightHandle = operWeight.EvalRegister();
+                using EvalItem = EiGenWeight<decltype(weightHandle), decltype(inHandle), decltype(outHandle)>;
+                using EvalGroup = EgGenWeight<decltype(weightHandle), decltype(inHandle), decltype(outHandle)>;
+                using EvalDispatcher = TrivalEvalItemDispatcher<EvalGroup>;
+
+                auto item = std::make_unique<EvalItem>(std::move(weightHandle), std::move(inHandle), std::move(outHandle));
+                EvalPlan<TDevice>::Inst().template Register<EvalDispatcher>(std::move(item));
+            }
+        }
+    }
+};
+}
+
 template <typename TWeight, typename TInput>
 struct OperCategory_<OpTags::NLLLoss, TWeight, TInput>
     : public GenLossOperCategory_
@@ -98,7 +333,8 @@ public:
 template <>
 struct OperSeq_<OpTags::NLLLoss>
 {
-    using type = OperCalAlgoChain<TailCalculator<OperNLLLoss::NSCaseGen::EvalItem, OperNLLLoss::NSCaseGen::EvalGroup>>;
+    using type = OperCalAlgoChain<OperNLLLoss::NSCaseSoftmax::Calculator,
+                                  TailCalculator<OperNLLLoss::NSCaseGen::EvalItem, OperNLLLoss::NSCaseGen::EvalGroup>>;
 };
 
 template <typename TWeight, typename TInput,
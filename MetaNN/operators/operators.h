@@ -3,6 +3,7 @@
 #include <MetaNN/operators/activations/_.h>
 #include <MetaNN/operators/blas/_.h>
 #include <MetaNN/operators/cate_trans/_.h>
+#include <MetaNN/operators/conv/_.h>
 #include <MetaNN/operators/elementwise/_.h>
 #include <MetaNN/operators/loss/_.h>
 #include <MetaNN/operators/mutating/_.h>
\ No newline at end of file
@@ -4,10 +4,12 @@ namespace Test::Data::Batch
 {
     void test_static_batch();
     void test_dynamic_batch();
+    void test_batch_one_hot_vector();
     
     inline void test()
     {
         test_static_batch();
         test_dynamic_batch();
+        test_batch_one_hot_vector();
     }
 }
@@ -0,0 +1,132 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_batch_one_hot_vector_case1()
+    {
+        cout << "Test batch one-hot vector case 1 (construction)\t";
+        static_assert(IsBatchMatrix<BatchOneHotVector<CheckElement, CheckDevice>>);
+        static_assert(IsOneHot<BatchOneHotVector<CheckElement, CheckDevice>>);
+        static_assert(IsOneHot<OneHotVector<CheckElement, CheckDevice>>);
+
+        std::vector<size_t> pos{3, 0, 7, 3};
+        BatchOneHotVector<CheckElement, CheckDevice> data(10, pos);
+        assert(data.Shape().BatchNum() == 4);
+        assert(data.Shape().RowNum() == 1);
+        assert(data.Shape().ColNum() == 10);
+        assert(data.HotPos(2) == 7);
+        assert(data[3].HotPos() == 3);
+
+        auto dense = Evaluate(data);
+        static_assert(std::is_same_v<decltype(dense), BatchMatrix<CheckElement, CheckDevice>>);
+        for (size_t b = 0; b < 4; ++b)
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                assert(dense[b](0, j) == ((j == pos[b]) ? 1 : 0));
+            }
+        }
+
+        bool exceptionCatched = false;
+        try
+        {
+            BatchOneHotVector<CheckElement, CheckDevice> invalid(10, std::vector<size_t>{10});
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
+
+    void test_batch_one_hot_vector_case2()
+    {
+        cout << "Test batch one-hot vector case 2 (gather dot)\t";
+        auto weight = GenMatrix<CheckElement>(10, 5, -1, 0.1f);
+
+        OneHotVector<CheckElement, CheckDevice> single(10, 6);
+        auto res = Evaluate(Dot(single, weight));
+        static_assert(std::is_same_v<decltype(res), Matrix<CheckElement, CheckDevice>>);
+        assert(res.Shape().RowNum() == 1);
+        assert(res.Shape().ColNum() == 5);
+        for (size_t j = 0; j < 5; ++j)
+        {
+            assert(res(0, j) == weight(6, j));
+        }
+
+        std::vector<size_t> pos{3, 0, 9};
+        BatchOneHotVector<CheckElement, CheckDevice> data(10, pos);
+        auto dup = Duplicate(weight, Shape<CategoryTags::BatchMatrix>(3, weight.Shape()));
+        auto resDup = Evaluate(Dot(data, dup));
+        static_assert(std::is_same_v<decltype(resDup), BatchMatrix<CheckElement, CheckDevice>>);
+
+        auto batchWeight = GenBatchMatrix<CheckElement>(3, 10, 5, 0.5f, -0.03f);
+        auto resBatch = Evaluate(Dot(data, batchWeight));
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(resDup[b](0, j) == weight(pos[b], j));
+                assert(resBatch[b](0, j) == batchWeight[b](pos[b], j));
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_batch_one_hot_vector_case3()
+    {
+        cout << "Test batch one-hot vector case 3 (scatter dot and collapse)\t";
+        OneHotVector<CheckElement, CheckDevice> single(10, 6);
+        auto g = GenMatrix<CheckElement>(1, 4, 1, 0.5f);
+        auto res = Evaluate(Dot(Transpose(single), g));
+        assert(res.Shape().RowNum() == 10);
+        assert(res.Shape().ColNum() == 4);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                assert(res(i, j) == ((i == 6) ? g(0, j) : 0));
+            }
+        }
+
+        std::vector<size_t> pos{3, 0, 3, 8};
+        BatchOneHotVector<CheckElement, CheckDevice> data(10, pos);
+        auto grad = GenBatchMatrix<CheckElement>(4, 1, 4, -0.3f, 0.07f);
+        auto resBatch = Evaluate(Dot(Transpose(data), grad));
+        auto resCollapse = Evaluate(Collapse(Dot(Transpose(data), grad), Shape<CategoryTags::Matrix>(10, 4)));
+        static_assert(std::is_same_v<decltype(resCollapse), Matrix<CheckElement, CheckDevice>>);
+
+        auto dense = Evaluate(data);
+        auto check = Evaluate(Collapse(Dot(Transpose(dense), grad), Shape<CategoryTags::Matrix>(10, 4)));
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                assert(fabs(resCollapse(i, j) - check(i, j)) < 0.0001f);
+                for (size_t b = 0; b < 4; ++b)
+                {
+                    assert(resBatch[b](i, j) == ((i == pos[b]) ? grad[b](0, j) : 0));
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Batch
+{
+    void test_batch_one_hot_vector()
+    {
+        test_batch_one_hot_vector_case1();
+        test_batch_one_hot_vector_case2();
+        test_batch_one_hot_vector_case3();
+    }
+}
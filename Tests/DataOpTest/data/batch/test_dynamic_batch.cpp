@@ -143,6 +143,100 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_dynamic_batch_matrix_case2()
+    {
+        cout << "Test dynamic batch matrix case 2 (zero-copy slices)...\t";
+        using TCardinal = Matrix<CheckElement, CheckDevice>;
+
+        BatchMatrix<CheckElement, CheckDevice> ori(4, 3, 5);
+        for (size_t b = 0; b < 4; ++b)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    ori.SetValue(b, i, j, (CheckElement)(b * 100 + i * 10 + j));
+                }
+            }
+        }
+
+        DynamicBatch<TCardinal> adjacent;
+        adjacent.PushBack(ori[1]);
+        adjacent.PushBack(ori[2]);
+        adjacent.PushBack(ori[3]);
+        auto res1 = Evaluate(adjacent);
+        assert(LowerAccess(res1).RawMemory() == LowerAccess(ori[1]).RawMemory());
+
+        DynamicBatch<TCardinal> gap;
+        gap.PushBack(ori[0]);
+        gap.PushBack(ori[2]);
+        auto res2 = Evaluate(gap);
+        assert(LowerAccess(res2).RawMemory() != LowerAccess(ori[0]).RawMemory());
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                for (size_t b = 0; b < 3; ++b)
+                {
+                    assert(res1[b](i, j) == ori[b + 1](i, j));
+                }
+                assert(res2[0](i, j) == ori[0](i, j));
+                assert(res2[1](i, j) == ori[2](i, j));
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_static_array_builder_case1()
+    {
+        cout << "Test static array builder case 1...\t";
+        StaticArrayBuilder<CheckElement, CheckDevice, CategoryTags::Batch, CategoryTags::Matrix> builder(Shape<CategoryTags::Matrix>(2, 3), 4);
+        assert(builder.Capacity() == 4);
+
+        auto slot = builder.Append();
+        auto lowSlot = LowerAccess(slot);
+        for (size_t i = 0; i < 6; ++i)
+        {
+            lowSlot.MutableRawMemory()[i] = (CheckElement)i;
+        }
+
+        Matrix<CheckElement, CheckDevice> me(2, 3);
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                me.SetValue(i, j, (CheckElement)(i * 3 + j + 10));
+            }
+        }
+        builder.PushBack(me);
+        assert(builder.Size() == 2);
+
+        auto res = builder.Build();
+        static_assert(std::is_same_v<decltype(res), BatchMatrix<CheckElement, CheckDevice>>);
+        assert(res.Shape().BatchNum() == 2);
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                assert(res[0](i, j) == (CheckElement)(i * 3 + j));
+                assert(res[1](i, j) == me(i, j));
+            }
+        }
+
+        bool exceptionCatched = false;
+        try
+        {
+            builder.PushBack(Matrix<CheckElement, CheckDevice>(3, 2));
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Data::Batch
@@ -152,5 +246,7 @@ namespace Test::Data::Batch
         test_dynamic_batch_scalar_case1();
         test_dynamic_batch_matrix_case1();
         test_dynamic_batch_3d_array_case1();
+        test_dynamic_batch_matrix_case2();
+        test_static_array_builder_case1();
     }
 }
\ No newline at end of file
@@ -245,6 +245,51 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_batch_matrix_sequence_case3()
+    {
+        cout << "Test static batch matrix sequence case 3 (offset table)...\t";
+        const std::vector<size_t> seqs = {3, 0, 5, 2};
+        BatchMatrixSequence<CheckElement, CheckDevice> check(seqs, 2, 3);
+        const auto& offsets = check.Shape().SeqOffsetContainer();
+        assert(offsets.size() == 5);
+        assert(offsets[0] == 0);
+        assert(offsets[1] == 3);
+        assert(offsets[2] == 3);
+        assert(offsets[3] == 8);
+        assert(offsets[4] == 10);
+        assert(check.Shape().SeqOffset(3) == 8);
+        assert(check.Shape().Count() == 60);
+
+        for (size_t s = 0; s < 4; ++s)
+        {
+            for (size_t i = 0; i < seqs[s]; ++i)
+            {
+                check.SetValue(s, i, 1, 2, (CheckElement)(s * 100 + i));
+            }
+        }
+
+        // packed iteration: sequence s is the cardinal elements [offsets[s], offsets[s + 1]).
+        const CheckElement* mem = LowerAccess(check).RawMemory();
+        for (size_t s = 0; s < 4; ++s)
+        {
+            assert(check[s].Shape().Length() == seqs[s]);
+            for (size_t p = offsets[s]; p < offsets[s + 1]; ++p)
+            {
+                assert(mem[p * 6 + 5] == (CheckElement)(s * 100 + p - offsets[s]));
+                assert(check[s][p - offsets[s]](1, 2) == mem[p * 6 + 5]);
+            }
+        }
+
+        Shape<CategoryTags::BatchMatrixSequence> shape({}, 2, 3);
+        shape.PushSeqLen(3);
+        shape.PushSeqLen(0);
+        shape.PushSeqLen(5);
+        shape.PushSeqLen(2);
+        assert(shape == check.Shape());
+        assert(shape.SeqOffset(4) == 10);
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Data::BatchSequence
@@ -254,6 +299,7 @@ namespace Test::Data::BatchSequence
         test_batch_scalar_sequence_case1();
         test_batch_matrix_sequence_case1();
         test_batch_matrix_sequence_case2();
+        test_batch_matrix_sequence_case3();
         test_batch_3d_array_sequence_case1();
     }
 }
\ No newline at end of file
@@ -3,9 +3,11 @@
 namespace Test::Data::Cardinal::ThreeDArray
 {
     void test_3d_array();
+    void test_channel_last_3d_array();
     
     void test()
     {
         test_3d_array();
+        test_channel_last_3d_array();
     }
 }
@@ -0,0 +1,131 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_channel_last_3d_array_case1()
+    {
+        cout << "Test channel-last 3d array case 1 (layout)\t";
+        using CheckType = ChannelLastThreeDArray<CheckElement, CheckDevice>;
+        static_assert(IsThreeDArray<CheckType>);
+        static_assert(IsChannelLast<CheckType>);
+
+        CheckType rm(3, 4, 5);
+        assert(rm.Shape().PageNum() == 3);
+        assert(rm.Shape().RowNum() == 4);
+        assert(rm.Shape().ColNum() == 5);
+        for (size_t p = 0; p < 3; ++p)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    rm.SetValue(p, i, j, (CheckElement)(p * 100 + i * 10 + j));
+                }
+            }
+        }
+
+        // the channels of a position are adjacent.
+        const CheckElement* mem = LowerAccess(rm).RawMemory();
+        assert(mem[0] == 0);
+        assert(mem[1] == 100);
+        assert(mem[2] == 200);
+        assert(mem[3] == 1);
+        assert(rm(2, 3, 4) == 234);
+
+        auto res = Evaluate(rm);
+        static_assert(std::is_same_v<decltype(res), ThreeDArray<CheckElement, CheckDevice>>);
+        for (size_t p = 0; p < 3; ++p)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    assert(res(p, i, j) == rm(p, i, j));
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_channel_last_3d_array_case2()
+    {
+        cout << "Test channel-last 3d array case 2 (conversion)\t";
+        auto ori = GenThreeDArray<CheckElement>(19, 7, 5, 0, 1);
+        ChannelLastThreeDArray<CheckElement, CheckDevice> rm(ori);
+        assert(rm.Shape() == ori.Shape());
+        for (size_t p = 0; p < 19; ++p)
+        {
+            for (size_t i = 0; i < 7; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    assert(rm(p, i, j) == ori(p, i, j));
+                }
+            }
+        }
+
+        auto res = Evaluate(rm + ori);
+        for (size_t p = 0; p < 19; ++p)
+        {
+            for (size_t i = 0; i < 7; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    assert(res(p, i, j) == 2 * ori(p, i, j));
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_channel_last_3d_array_case3()
+    {
+        cout << "Test channel-last 3d array case 3 (batch)\t";
+        using CheckType = BatchChannelLastThreeDArray<CheckElement, CheckDevice>;
+        static_assert(IsBatchThreeDArray<CheckType>);
+        static_assert(IsChannelLast<CheckType>);
+
+        auto ori = GenBatchThreeDArray<CheckElement>(3, 17, 4, 6, 0, 1);
+        CheckType rm(ori);
+        assert(rm.Shape() == ori.Shape());
+        assert(rm(2, 16, 3, 5) == ori[2](16, 3, 5));
+        const CheckElement* mem = LowerAccess(rm).RawMemory();
+        assert(mem[17 * 4 * 6] == ori[1](0, 0, 0));
+        assert(mem[17 * 4 * 6 + 1] == ori[1](1, 0, 0));
+
+        rm.SetValue(1, 2, 3, 4, -1);
+        assert(rm(1, 2, 3, 4) == -1);
+
+        auto res = Evaluate(rm);
+        static_assert(std::is_same_v<decltype(res), BatchThreeDArray<CheckElement, CheckDevice>>);
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t p = 0; p < 17; ++p)
+            {
+                for (size_t i = 0; i < 4; ++i)
+                {
+                    for (size_t j = 0; j < 6; ++j)
+                    {
+                        assert(res[b](p, i, j) == rm(b, p, i, j));
+                    }
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::ThreeDArray
+{
+    void test_channel_last_3d_array()
+    {
+        test_channel_last_3d_array_case1();
+        test_channel_last_3d_array_case2();
+        test_channel_last_3d_array_case3();
+    }
+}
@@ -3,6 +3,12 @@
 namespace Test::Data::Cardinal::Matrix
 {
     void test_matrix();
+    void test_csr_matrix();
+    void test_fixed_matrix();
+    void test_matrix_view();
+    void test_packed_matrix();
+    void test_half_matrix();
+    void test_quantized_matrix();
     void test_trival_matrix();
     void test_vector();
     void test_one_hot_vector();
@@ -10,6 +16,12 @@ namespace Test::Data::Cardinal::Matrix
     inline void test()
     {
         test_matrix();
+        test_csr_matrix();
+        test_fixed_matrix();
+        test_matrix_view();
+        test_packed_matrix();
+        test_half_matrix();
+        test_quantized_matrix();
         test_trival_matrix();
         test_vector();
         test_one_hot_vector();
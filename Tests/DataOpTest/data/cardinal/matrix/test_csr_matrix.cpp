@@ -0,0 +1,118 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+#include <tuple>
+#include <vector>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    auto GenTriples()
+    {
+        std::vector<std::tuple<size_t, size_t, CheckElement>> triples;
+        triples.emplace_back(3, 7, 1.5f);
+        triples.emplace_back(0, 2, -2.0f);
+        triples.emplace_back(3, 1, 0.25f);
+        triples.emplace_back(5, 9, 4.0f);
+        triples.emplace_back(0, 2, 1.0f);
+        triples.emplace_back(1, 0, 3.0f);
+        return triples;
+    }
+
+    void test_csr_matrix_case1()
+    {
+        cout << "Test csr matrix case 1 (construction)\t";
+        static_assert(IsMatrix<CsrMatrix<CheckElement, CheckDevice>>);
+        static_assert(IsCsrMatrix<CsrMatrix<CheckElement, CheckDevice>>);
+
+        CsrMatrix<CheckElement, CheckDevice> empty(4, 5);
+        assert(empty.NonZeroNum() == 0);
+        assert(empty(3, 4) == 0);
+
+        CsrMatrix<CheckElement, CheckDevice> rm(6, 10, GenTriples());
+        assert(rm.Shape().RowNum() == 6);
+        assert(rm.Shape().ColNum() == 10);
+        assert(rm.NonZeroNum() == 5);
+        assert(rm(0, 2) == -1.0f);
+        assert(rm(1, 0) == 3.0f);
+        assert(rm(3, 1) == 0.25f);
+        assert(rm(3, 7) == 1.5f);
+        assert(rm(5, 9) == 4.0f);
+        assert(rm(2, 2) == 0);
+
+        auto dense = Evaluate(rm);
+        static_assert(std::is_same_v<decltype(dense), Matrix<CheckElement, CheckDevice>>);
+        for (size_t i = 0; i < 6; ++i)
+        {
+            for (size_t j = 0; j < 10; ++j)
+            {
+                assert(dense(i, j) == rm(i, j));
+            }
+        }
+
+        bool exceptionCatched = false;
+        try
+        {
+            std::vector<std::tuple<size_t, size_t, CheckElement>> triples{{6, 0, 1.0f}};
+            CsrMatrix<CheckElement, CheckDevice> invalid(6, 10, triples);
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
+
+    void test_csr_matrix_case2()
+    {
+        cout << "Test csr matrix case 2 (sparse dot)\t";
+        CsrMatrix<CheckElement, CheckDevice> sparse(6, 10, GenTriples());
+        auto in = GenMatrix<CheckElement>(10, 4, -1, 0.1f);
+        auto res = Evaluate(Dot(sparse, in));
+        assert(res.Shape().RowNum() == 6);
+        assert(res.Shape().ColNum() == 4);
+        for (size_t i = 0; i < 6; ++i)
+        {
+            for (size_t j = 0; j < 4; ++j)
+            {
+                CheckElement value = 0;
+                for (size_t k = 0; k < 10; ++k)
+                {
+                    value += sparse(i, k) * in(k, j);
+                }
+                assert(fabs(value - res(i, j)) < 0.001f);
+            }
+        }
+
+        auto grad = GenMatrix<CheckElement>(6, 3, 0.5f, -0.2f);
+        auto resT = Evaluate(Dot(Transpose(sparse), grad));
+        assert(resT.Shape().RowNum() == 10);
+        assert(resT.Shape().ColNum() == 3);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                CheckElement value = 0;
+                for (size_t k = 0; k < 6; ++k)
+                {
+                    value += sparse(k, i) * grad(k, j);
+                }
+                assert(fabs(value - resT(i, j)) < 0.001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_csr_matrix()
+    {
+        test_csr_matrix_case1();
+        test_csr_matrix_case2();
+    }
+}
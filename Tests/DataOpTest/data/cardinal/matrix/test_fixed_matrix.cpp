@@ -0,0 +1,118 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    template <size_t R, size_t C>
+    auto GenFixedMatrix(CheckElement start, CheckElement step)
+    {
+        return FixedMatrix<CheckElement, CheckDevice, R, C>(GenMatrix<CheckElement>(R, C, start, step));
+    }
+
+    void test_fixed_matrix_case1()
+    {
+        cout << "Test fixed matrix case 1 (construction)\t";
+        using FixType = FixedMatrix<CheckElement, CheckDevice, 3, 5>;
+        static_assert(IsMatrix<FixType>);
+        static_assert(IsFixedMatrix<FixType>);
+        static_assert(FixType::FixedRowNum == 3);
+        static_assert(FixType::FixedColNum == 5);
+
+        FixType rm;
+        assert(rm.Shape().RowNum() == 3);
+        assert(rm.Shape().ColNum() == 5);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                rm.SetValue(i, j, (CheckElement)(i * 10 + j));
+            }
+        }
+        assert(rm(2, 4) == 24);
+
+        auto ori = GenMatrix<CheckElement>(3, 5, 0, 1);
+        FixType shared(ori);
+        auto evalRes = Evaluate(shared);
+        static_assert(std::is_same_v<decltype(evalRes), Matrix<CheckElement, CheckDevice>>);
+        assert(LowerAccess(evalRes).RawMemory() == LowerAccess(ori).RawMemory());
+
+        bool exceptionCatched = false;
+        try
+        {
+            FixType invalid(GenMatrix<CheckElement>(5, 3));
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
+
+    void test_fixed_matrix_case2()
+    {
+        cout << "Test fixed matrix case 2 (fixed-shape dot)\t";
+        auto a = GenFixedMatrix<7, 32>(-1, 0.01f);
+        auto b = GenFixedMatrix<32, 9>(0.5f, -0.02f);
+        auto res = Evaluate(Dot(a, b));
+        static_assert(std::is_same_v<decltype(res), Matrix<CheckElement, CheckDevice>>);
+        assert(res.Shape().RowNum() == 7);
+        assert(res.Shape().ColNum() == 9);
+
+        // mixed with a dynamic matrix takes the general path.
+        auto c = GenMatrix<CheckElement>(32, 9, 0.5f, -0.02f);
+        auto check = Evaluate(Dot(a, c));
+        for (size_t i = 0; i < 7; ++i)
+        {
+            for (size_t j = 0; j < 9; ++j)
+            {
+                CheckElement value = 0;
+                for (size_t k = 0; k < 32; ++k)
+                {
+                    value += a(i, k) * b(k, j);
+                }
+                assert(fabs(value - res(i, j)) < 0.001f);
+                assert(fabs(check(i, j) - res(i, j)) < 0.001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_fixed_matrix_case3()
+    {
+        cout << "Test fixed matrix case 3 (fixed-shape elementwise)\t";
+        auto a = GenFixedMatrix<4, 6>(1, 0.3f);
+        auto b = GenFixedMatrix<4, 6>(2, -0.1f);
+        auto add = Evaluate(a + b);
+        auto sub = Evaluate(a - b);
+        auto mul = Evaluate(a * b);
+        auto div = Evaluate(a / b);
+        static_assert(std::is_same_v<decltype(add), Matrix<CheckElement, CheckDevice>>);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 6; ++j)
+            {
+                assert(fabs(add(i, j) - (a(i, j) + b(i, j))) < 0.0001f);
+                assert(fabs(sub(i, j) - (a(i, j) - b(i, j))) < 0.0001f);
+                assert(fabs(mul(i, j) - (a(i, j) * b(i, j))) < 0.0001f);
+                assert(fabs(div(i, j) - (a(i, j) / b(i, j))) < 0.0001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_fixed_matrix()
+    {
+        test_fixed_matrix_case1();
+        test_fixed_matrix_case2();
+        test_fixed_matrix_case3();
+    }
+}
@@ -0,0 +1,121 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+#include <limits>
+#include <tuple>
+#include <vector>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_half_matrix_case1()
+    {
+        cout << "Test half matrix case 1 (conversion)\t";
+        static_assert(sizeof(Float16) == 2);
+        static_assert(sizeof(BFloat16) == 2);
+        static_assert(std::is_same_v<ComputeType<Float16>, float>);
+        static_assert(std::is_same_v<ComputeType<BFloat16>, float>);
+        static_assert(std::is_same_v<ComputeType<double>, double>);
+
+        assert(Float16(1.0f).Bits() == 0x3c00);
+        assert(Float16(-2.0f).Bits() == 0xc000);
+        assert(Float16(65504.0f).Bits() == 0x7bff);
+        assert(Float16(65536.0f).Bits() == 0x7c00);
+        assert(Float16(5.9604645e-8f).Bits() == 0x0001);
+        assert((float)Float16::FromBits(0x0001) == 5.9604645e-8f);
+        assert((float)Float16::FromBits(0x3555) == 0.33325195f);
+        assert(Float16(1.0f + 1.0f / 2048).Bits() == 0x3c00);   // tie, round to even
+        assert(Float16(1.0f + 3.0f / 2048).Bits() == 0x3c02);
+        assert(std::isnan((float)Float16(std::numeric_limits<float>::quiet_NaN())));
+
+        assert(BFloat16(1.0f).Bits() == 0x3f80);
+        assert((float)BFloat16(3.0e38f) > 2.9e38f);
+        assert(fabs((float)BFloat16(0.1f) - 0.1f) < 0.001f);
+
+        Float16 val = 1.5f;
+        val += 2;
+        val *= 2;
+        assert(val == 7.0f);
+        cout << "done" << endl;
+    }
+
+    void test_half_matrix_case2()
+    {
+        cout << "Test half matrix case 2 (matrix and batch)\t";
+        auto rm = GenMatrix<Float16>(10, 20, 0, 0.25f);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (size_t j = 0; j < 20; ++j)
+            {
+                assert(rm(i, j) == (i * 20 + j) * 0.25f);
+            }
+        }
+
+        auto bm = GenBatchMatrix<BFloat16>(3, 2, 4, -1, 0.5f);
+        assert(bm[2](1, 3) == -1 + 0.5f * 23);
+
+        Matrix<Float16, CheckDevice> weight(8, 16);
+        GaussianFiller<> filler(0, 1, 12345);
+        filler.Fill(weight);
+        float sum = 0;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t j = 0; j < 16; ++j)
+            {
+                sum += fabs(weight(i, j));
+            }
+        }
+        assert(sum > 0);
+        cout << "done" << endl;
+    }
+
+    void test_half_matrix_case3()
+    {
+        cout << "Test half matrix case 3 (fp32 accumulation)\t";
+        // 2048 + 1 is not representable in fp16: accumulating in fp16 would stop at 2048.
+        const size_t len = 4096;
+        auto in1 = GenMatrix<Float16>(1, len, 1, 0);
+        auto in2 = GenMatrix<Float16>(len, 1, 1, 0);
+        auto dot = Evaluate(Dot(in1, in2));
+        assert(dot(0, 0) == (float)len);
+
+        std::vector<std::tuple<size_t, size_t, Float16>> rowTriples, colTriples;
+        for (size_t i = 0; i < len; ++i)
+        {
+            rowTriples.emplace_back(0, i, Float16(1.0f));
+            colTriples.emplace_back(i, 0, Float16(1.0f));
+        }
+        CsrMatrix<Float16, CheckDevice> sparseRow(1, len, rowTriples);
+        CsrMatrix<Float16, CheckDevice> sparseCol(len, 1, colTriples);
+        assert(Evaluate(Dot(sparseRow, in2))(0, 0) == (float)len);
+        assert(Evaluate(Dot(Transpose(sparseCol), in2))(0, 0) == (float)len);
+
+        auto batch = GenBatchMatrix<Float16>(len, 1, 2, 1, 0);
+        auto collapse = Evaluate(Collapse(batch, Shape<CategoryTags::Matrix>(1, 2)));
+        assert(collapse(0, 0) == (float)len);
+        assert(collapse(0, 1) == (float)len);
+
+        auto ori = GenMatrix<BFloat16>(1, len, -3, 0.001f);
+        auto softmax = Evaluate(Softmax(ori));
+        float total = 0;
+        for (size_t i = 0; i < len; ++i)
+        {
+            total += softmax(0, i);
+        }
+        assert(fabs(total - 1) < 0.01f);
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_half_matrix()
+    {
+        test_half_matrix_case1();
+        test_half_matrix_case2();
+        test_half_matrix_case3();
+    }
+}
@@ -1,6 +1,7 @@
 #include <MetaNN/meta_nn.h>
 #include <calculate_tags.h>
 #include <iostream>
+#include <vector>
 using namespace std;
 using namespace MetaNN;
 
@@ -65,6 +66,30 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_matrix_case3()
+    {
+        cout << "Test matrix case 3 (adopt external buffer)...\t";
+        std::vector<CheckElement> buffer(12);
+        for (size_t i = 0; i < 12; ++i)
+        {
+            buffer[i] = (CheckElement)i;
+        }
+
+        bool released = false;
+        {
+            ContinuousMemory<CheckElement, CheckDevice> mem(buffer.data(), [&released](CheckElement*) { released = true; });
+            Matrix<CheckElement, CheckDevice> rm(mem, 3, 4);
+            assert(LowerAccess(rm).RawMemory() == buffer.data());
+            assert(rm(2, 1) == 9);
+
+            auto res = Evaluate(rm + rm);
+            assert(res(2, 1) == 18);
+            assert(!released);
+        }
+        assert(released);
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Data::Cardinal::Matrix
@@ -73,5 +98,6 @@ namespace Test::Data::Cardinal::Matrix
     {
         test_matrix_case1();
         test_matrix_case2();
+        test_matrix_case3();
     }
 }
\ No newline at end of file
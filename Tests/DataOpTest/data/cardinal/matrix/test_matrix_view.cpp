@@ -0,0 +1,144 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_matrix_view_case1()
+    {
+        cout << "Test matrix view case 1 (element access)\t";
+        static_assert(IsMatrix<MatrixView<CheckElement, CheckDevice>>);
+        static_assert(IsMatrixView<MatrixView<CheckElement, CheckDevice>>);
+
+        auto ori = GenMatrix<CheckElement>(10, 20);
+        MatrixView<CheckElement, CheckDevice> view(ori, 2, 5, 3, 9);
+        assert(view.Shape().RowNum() == 3);
+        assert(view.Shape().ColNum() == 6);
+        assert(view.RowLen() == 20);
+        assert(!view.IsContinuous());
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 6; ++j)
+            {
+                assert(view(i, j) == ori(i + 2, j + 3));
+            }
+        }
+
+        MatrixView<CheckElement, CheckDevice> sub(view, 1, 3, 2, 4);
+        assert(sub.Shape().RowNum() == 2);
+        assert(sub.Shape().ColNum() == 2);
+        assert(sub.RowLen() == 20);
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (size_t j = 0; j < 2; ++j)
+            {
+                assert(sub(i, j) == ori(i + 3, j + 5));
+            }
+        }
+
+        // a reversed range would wrap the shape: it has to be rejected, not shifted to.
+        auto outOfBound = [&ori, &view](size_t rb, size_t re, size_t cb, size_t ce, bool fromView)
+        {
+            try
+            {
+                if (fromView) MatrixView<CheckElement, CheckDevice>(view, rb, re, cb, ce);
+                else MatrixView<CheckElement, CheckDevice>(ori, rb, re, cb, ce);
+            }
+            catch (std::runtime_error&)
+            {
+                return true;
+            }
+            return false;
+        };
+        assert(outOfBound(5, 2, 0, 1, false));
+        assert(outOfBound(0, 11, 0, 1, false));
+        assert(outOfBound(0, 1, 3, 21, false));
+        assert(outOfBound(0, 4, 0, 1, true));
+        assert(outOfBound(0, 1, 4, 3, true));
+        assert(!outOfBound(3, 3, 6, 6, true));
+        cout << "done" << endl;
+    }
+
+    void test_matrix_view_case2()
+    {
+        cout << "Test matrix view case 2 (evaluate)\t";
+        auto ori = GenMatrix<CheckElement>(10, 20);
+
+        auto rows = RowRange(ori, 4, 7);
+        assert(rows.IsContinuous());
+        auto rowRes = Evaluate(rows);
+        static_assert(std::is_same_v<decltype(rowRes), Matrix<CheckElement, CheckDevice>>);
+        assert(LowerAccess(rowRes).RawMemory() == LowerAccess(ori).RawMemory() + 4 * 20);
+
+        auto cols = ColRange(ori, 5, 8);
+        assert(!cols.IsContinuous());
+        auto colRes = Evaluate(cols);
+        assert(colRes.Shape().RowNum() == 10);
+        assert(colRes.Shape().ColNum() == 3);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                assert(colRes(i, j) == ori(i, j + 5));
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_matrix_view_case3()
+    {
+        cout << "Test matrix view case 3 (operators)\t";
+        auto ori1 = GenMatrix<CheckElement>(8, 10, 0, 0.01f);
+        auto ori2 = GenMatrix<CheckElement>(6, 9, -1, 0.02f);
+        auto in1 = ColRange(ori1, 2, 7);
+        auto in2 = MatrixView<CheckElement, CheckDevice>(ori2, 1, 6, 3, 8);
+        auto res = Evaluate(Dot(in1, in2));
+        assert(res.Shape().RowNum() == 8);
+        assert(res.Shape().ColNum() == 5);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                CheckElement value = 0;
+                for (size_t k = 0; k < 5; ++k)
+                {
+                    value += in1(i, k) * in2(k, j);
+                }
+                assert(fabs(value - res(i, j)) < 0.001f);
+            }
+        }
+
+        auto in3 = GenMatrix<CheckElement>(8, 5, 3, 0.5f);
+        auto sum = Evaluate(in1 + in3);
+        auto diff = Evaluate(in3 - in1);
+        CheckElement total = 0;
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(fabs(sum(i, j) - in1(i, j) - in3(i, j)) < 0.001f);
+                assert(fabs(diff(i, j) - in3(i, j) + in1(i, j)) < 0.001f);
+                total += in1(i, j);
+            }
+        }
+
+        auto collapse = Evaluate(Collapse(in1, Shape<CategoryTags::Scalar>()));
+        assert(fabs(collapse.Value() - total) < 0.001f);
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_matrix_view()
+    {
+        test_matrix_view_case1();
+        test_matrix_view_case2();
+        test_matrix_view_case3();
+    }
+}
@@ -0,0 +1,90 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_packed_matrix_case1()
+    {
+        cout << "Test packed matrix case 1 (pack / unpack)\t";
+        static_assert(IsMatrix<PackedMatrix<CheckElement, CheckDevice>>);
+        static_assert(IsPackedMatrix<PackedMatrix<CheckElement, CheckDevice>>);
+
+        PackedMatrix<CheckElement, CheckDevice> empty(3, 5);
+        assert(empty.PanelNum() == 1);
+        assert(empty(2, 4) == 0);
+
+        auto ori = GenMatrix<CheckElement>(7, 19, -3, 0.1f);
+        PackedMatrix<CheckElement, CheckDevice> packed(ori);
+        assert(packed.Shape() == ori.Shape());
+        constexpr size_t width = PackedMatrix<CheckElement, CheckDevice>::PanelWidth;
+        assert(packed.PanelNum() == (19 + width - 1) / width);
+
+        auto unpacked = Evaluate(packed);
+        static_assert(std::is_same_v<decltype(unpacked), Matrix<CheckElement, CheckDevice>>);
+        for (size_t i = 0; i < 7; ++i)
+        {
+            for (size_t j = 0; j < 19; ++j)
+            {
+                assert(packed(i, j) == ori(i, j));
+                assert(unpacked(i, j) == ori(i, j));
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_packed_matrix_case2()
+    {
+        cout << "Test packed matrix case 2 (packed dot)\t";
+        auto weight = GenMatrix<CheckElement>(23, 17, 0.5f, -0.007f);
+        LoadBuffer<CheckElement, CheckDevice> buffer;
+        buffer.Set("w", weight);
+        auto packed = PackParam(buffer, "w");
+        static_assert(std::is_same_v<decltype(packed), PackedMatrix<CheckElement, CheckDevice>>);
+
+        // 8 rows: one full register block of 6 rows and 2 remaining rows.
+        auto in = GenMatrix<CheckElement>(8, 23, -1, 0.013f);
+        auto res = Evaluate(Dot(in, packed));
+        assert(res.Shape().RowNum() == 8);
+        assert(res.Shape().ColNum() == 17);
+        for (size_t i = 0; i < 8; ++i)
+        {
+            for (size_t j = 0; j < 17; ++j)
+            {
+                CheckElement value = 0;
+                for (size_t k = 0; k < 23; ++k)
+                {
+                    value += in(i, k) * weight(k, j);
+                }
+                assert(fabs(value - res(i, j)) < 0.001f);
+            }
+        }
+
+        // more rows than one K block of the GEMM: later blocks start inside the panels.
+        auto bigWeight = GenMatrix<CheckElement>(300, 37, -0.5f, 0.0001f);
+        auto bigIn = GenMatrix<CheckElement>(13, 300, 0.2f, -0.0003f);
+        auto bigRes = Evaluate(Dot(bigIn, PackedMatrix<CheckElement, CheckDevice>(bigWeight)));
+        auto bigCheck = Evaluate(Dot(bigIn, bigWeight));
+        for (size_t i = 0; i < 13; ++i)
+        {
+            for (size_t j = 0; j < 37; ++j)
+            {
+                assert(fabs(bigCheck(i, j) - bigRes(i, j)) < 0.001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_packed_matrix()
+    {
+        test_packed_matrix_case1();
+        test_packed_matrix_case2();
+    }
+}
@@ -0,0 +1,96 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_quantized_matrix_case1()
+    {
+        cout << "Test quantized matrix case 1 (quantize / dequantize)\t";
+        static_assert(IsMatrix<QuantizedMatrix<CheckElement, CheckDevice>>);
+        static_assert(IsQuantizedMatrix<QuantizedMatrix<CheckElement, CheckDevice>>);
+
+        auto ori = GenMatrix<CheckElement>(6, 10, -3, 0.1f);
+        QuantizedMatrix<CheckElement, CheckDevice> colQuant(ori);
+        QuantizedMatrix<CheckElement, CheckDevice> tensorQuant(ori, false);
+        assert(colQuant.IsPerColumn());
+        assert(!tensorQuant.IsPerColumn());
+        assert(colQuant.Shape() == ori.Shape());
+
+        auto deq = Evaluate(colQuant);
+        static_assert(std::is_same_v<decltype(deq), Matrix<CheckElement, CheckDevice>>);
+        for (size_t j = 0; j < 10; ++j)
+        {
+            CheckElement colMax = 0;
+            for (size_t i = 0; i < 6; ++i)
+            {
+                colMax = std::max(colMax, (CheckElement)fabs(ori(i, j)));
+            }
+            for (size_t i = 0; i < 6; ++i)
+            {
+                assert(fabs(deq(i, j) - ori(i, j)) <= colMax / 254 + 0.0001f);
+                assert(fabs(colQuant(i, j) - deq(i, j)) < 0.0001f);
+                assert(fabs(tensorQuant(i, j) - ori(i, j)) <= 3.0f / 254 + 0.0001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_quantized_matrix_case2()
+    {
+        cout << "Test quantized matrix case 2 (quantized dot)\t";
+        auto in = GenMatrix<CheckElement>(4, 32, -1, 0.013f);
+        auto weight = GenMatrix<CheckElement>(32, 5, 0.5, -0.007f);
+
+        LoadBuffer<CheckElement, CheckDevice> buffer;
+        buffer.Set("w", weight);
+        for (bool perColumn : {true, false})
+        {
+            auto qWeight = QuantizeParam(buffer, "w", perColumn);
+            auto res = Evaluate(Dot(in, qWeight));
+            static_assert(std::is_same_v<decltype(res), Matrix<CheckElement, CheckDevice>>);
+            assert(res.Shape().RowNum() == 4);
+            assert(res.Shape().ColNum() == 5);
+
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    CheckElement value = 0;
+                    CheckElement bound = 0;
+                    for (size_t k = 0; k < 32; ++k)
+                    {
+                        value += in(i, k) * weight(k, j);
+                        bound += fabs(in(i, k) * weight(k, j));
+                    }
+                    assert(fabs(value - res(i, j)) < 0.02f * bound + 0.001f);
+                }
+            }
+        }
+
+        bool exceptionCatched = false;
+        try
+        {
+            QuantizeParam(buffer, "not_exist");
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::Cardinal::Matrix
+{
+    void test_quantized_matrix()
+    {
+        test_quantized_matrix_case1();
+        test_quantized_matrix_case2();
+    }
+}
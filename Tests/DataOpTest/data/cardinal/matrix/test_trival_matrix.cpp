@@ -1,3 +1,4 @@
+#include <data_gen.h>
 #include <MetaNN/meta_nn.h>
 #include <calculate_tags.h>
 #include <cmath>
@@ -65,6 +66,85 @@ namespace
 
         cout << "done" << endl;
     }
+    void test_trival_matrix_case3()
+    {
+        cout << "Test trival matrix case 3 (consumed as scalar)...\t";
+        auto x = GenMatrix<CheckElement>(4, 6, 1, 0.5f);
+        auto c = TrivalMatrix(Scalar<CheckElement, CheckDevice>{2}, 4, 6);
+        static_assert(IsConstantOperand<decltype(c)>);
+
+        auto add = Evaluate(x + c);
+        auto sub = Evaluate(c - x);
+        auto mul = Evaluate(x * c);
+        auto div = Evaluate(c / x);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 6; ++j)
+            {
+                assert(fabs(add(i, j) - (x(i, j) + 2)) < 0.0001f);
+                assert(fabs(sub(i, j) - (2 - x(i, j))) < 0.0001f);
+                assert(fabs(mul(i, j) - (x(i, j) * 2)) < 0.0001f);
+                assert(fabs(div(i, j) - (2 / x(i, j))) < 0.0001f);
+            }
+        }
+
+        // x (4 * 6) . c (6 * 3): every element of row i is 3 * sum(x row i).
+        auto right = Evaluate(Dot(x, TrivalMatrix(Scalar<CheckElement, CheckDevice>{3}, 6, 3)));
+        assert(right.Shape().RowNum() == 4);
+        assert(right.Shape().ColNum() == 3);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            CheckElement sum = 0;
+            for (size_t k = 0; k < 6; ++k) sum += x(i, k);
+            for (size_t j = 0; j < 3; ++j)
+            {
+                assert(fabs(right(i, j) - 3 * sum) < 0.001f);
+            }
+        }
+
+        // c (5 * 4) . x (4 * 6): every element of column j is 3 * sum(x column j).
+        auto left = Evaluate(Dot(TrivalMatrix(Scalar<CheckElement, CheckDevice>{3}, 5, 4), x));
+        assert(left.Shape().RowNum() == 5);
+        assert(left.Shape().ColNum() == 6);
+        for (size_t j = 0; j < 6; ++j)
+        {
+            CheckElement sum = 0;
+            for (size_t k = 0; k < 4; ++k) sum += x(k, j);
+            for (size_t i = 0; i < 5; ++i)
+            {
+                assert(fabs(left(i, j) - 3 * sum) < 0.001f);
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_trival_matrix_case4()
+    {
+        cout << "Test trival matrix case 4 (dot with fp32 accumulation)...\t";
+        // 2048 + 1 is not representable in fp16: summing in fp16 would stop at 2048.
+        const size_t len = 4096;
+        const Float16 one(1.0f);
+        auto row = GenMatrix<Float16>(2, len, 1, 0);
+        auto right = Evaluate(Dot(row, TrivalMatrix(Scalar<Float16, CheckDevice>{one}, len, 3)));
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                assert((float)right(i, j) == (float)len);
+            }
+        }
+
+        auto col = GenMatrix<Float16>(len, 3, 1, 0);
+        auto left = Evaluate(Dot(TrivalMatrix(Scalar<Float16, CheckDevice>{one}, 2, len), col));
+        for (size_t i = 0; i < 2; ++i)
+        {
+            for (size_t j = 0; j < 3; ++j)
+            {
+                assert((float)left(i, j) == (float)len);
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Data::Cardinal::Matrix
@@ -73,5 +153,7 @@ namespace Test::Data::Cardinal::Matrix
     {
         test_trival_matrix_case1();
         test_trival_matrix_case2();
+        test_trival_matrix_case3();
+        test_trival_matrix_case4();
     }
 }
\ No newline at end of file
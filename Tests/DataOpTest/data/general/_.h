@@ -3,11 +3,13 @@
 namespace Test::Data::General
 {
     void test_dynamic();
+    void test_mapped_file();
     void test_zero_data();
     
     void test()
     {
         test_dynamic();
+        test_mapped_file();
         test_zero_data();
     }
 }
\ No newline at end of file
@@ -73,6 +73,52 @@ namespace
         cout << "done" << endl;
     }
     
+    void test_dynamic_matrix_case2()
+    {
+        cout << "Test dynamic matrix case 2 (inline and wrapped data)...\t";
+        using CheckType = DynamicData<CheckElement, CheckDevice, CategoryTags::Matrix>;
+        
+        Matrix<CheckElement, CheckDevice> internal(3, 5);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                internal.SetValue(i, j, (CheckElement)(i * 5 + j));
+            }
+        }
+        CheckType dMatrix = MakeDynamic(internal);
+        auto castPtr1 = dMatrix.TryCastTo<Matrix<CheckElement, CheckDevice>>();
+        assert(castPtr1);
+        assert(LowerAccess(*castPtr1).RawMemory() == LowerAccess(internal).RawMemory());
+        auto handle = dMatrix.EvalRegister();
+        assert(LowerAccess(handle.Data()).RawMemory() == LowerAccess(internal).RawMemory());
+        auto handleCopy = handle;
+        assert(LowerAccess(handleCopy.Data()).RawMemory() == LowerAccess(internal).RawMemory());
+        
+        auto trival = TrivalMatrix(Scalar<CheckElement, CheckDevice>{2}, 3, 5);
+        CheckType dTrival = MakeDynamic(trival);
+        CheckType dTrival2 = MakeDynamic(TrivalMatrix(Scalar<CheckElement, CheckDevice>{3}, 3, 5));
+        assert(dTrival.Shape() == dMatrix.Shape());
+        assert(dTrival == dTrival);
+        assert(dTrival != dTrival2);
+        assert(dTrival != dMatrix);
+        assert(dMatrix != dTrival);
+        auto castPtr2 = dTrival.TryCastTo<Matrix<CheckElement, CheckDevice>>();
+        assert(!castPtr2);
+        auto castPtr3 = dTrival.TryCastTo<decltype(trival)>();
+        assert(castPtr3);
+        
+        auto evalRes = Evaluate(dMatrix + dTrival);
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(evalRes(i, j) == (CheckElement)(i * 5 + j + 2));
+            }
+        }
+        cout << "done" << endl;
+    }
+    
     void test_dynamic_3d_array_case1()
     {
         cout << "Test dynamic 3d array case 1...\t";
@@ -445,6 +491,7 @@ namespace Test::Data::General
     {
         test_dynamic_scalar_case1();
         test_dynamic_matrix_case1();
+        test_dynamic_matrix_case2();
         test_dynamic_3d_array_case1();
         
         test_dynamic_batch_scalar_case1();
@@ -0,0 +1,107 @@
+#include <MetaNN/meta_nn.h>
+#include <MetaNN/data/facilities/mapped_file.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <unistd.h>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    std::string WriteTempFile(const std::vector<CheckElement>& data)
+    {
+        char name[] = "/tmp/metann_mapped_XXXXXX";
+        const int fd = mkstemp(name);
+        assert(fd >= 0);
+        const size_t bytes = sizeof(CheckElement) * data.size();
+        const ssize_t written = write(fd, data.data(), bytes);
+        close(fd);
+        assert(written == (ssize_t)bytes);
+        return name;
+    }
+
+    void test_mapped_file_case1()
+    {
+        cout << "Test mapped file case 1...\t";
+        std::vector<CheckElement> content(200);
+        for (size_t i = 0; i < content.size(); ++i)
+        {
+            content[i] = (CheckElement)(i * 0.5f);
+        }
+        const std::string path = WriteTempFile(content);
+
+        Matrix<CheckElement, CheckDevice> mat;
+        BatchMatrix<CheckElement, CheckDevice> batch;
+        {
+            MappedFile file(path);
+            assert(file.Size() == sizeof(CheckElement) * 200);
+
+            mat = MapData<Matrix<CheckElement, CheckDevice>>(file, 0, Shape<CategoryTags::Matrix>(4, 5));
+            auto arr = MapData<ThreeDArray<CheckElement, CheckDevice>>(file, sizeof(CheckElement) * 20,
+                                                                       Shape<CategoryTags::ThreeDArray>(2, 3, 4));
+            batch = MapData<BatchMatrix<CheckElement, CheckDevice>>(file, sizeof(CheckElement) * 100,
+                                                                    Shape<CategoryTags::BatchMatrix>(10, 2, 5));
+            for (size_t p = 0; p < 2; ++p)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    for (size_t j = 0; j < 4; ++j)
+                    {
+                        assert(arr(p, i, j) == content[20 + p * 12 + i * 4 + j]);
+                    }
+                }
+            }
+
+            bool exceptionCatched = false;
+            try
+            {
+                MapData<Matrix<CheckElement, CheckDevice>>(file, sizeof(CheckElement) * 190,
+                                                           Shape<CategoryTags::Matrix>(4, 5));
+            }
+            catch (std::runtime_error&)
+            {
+                exceptionCatched = true;
+            }
+            assert(exceptionCatched);
+        }
+
+        // the mapping stays valid after the file object is released.
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(mat(i, j) == content[i * 5 + j]);
+            }
+        }
+        for (size_t b = 0; b < 10; ++b)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(batch[b](1, j) == content[100 + b * 10 + 5 + j]);
+            }
+        }
+
+        auto res = Evaluate(mat + mat);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(fabs(res(i, j) - 2 * content[i * 5 + j]) < 0.0001f);
+            }
+        }
+        std::remove(path.c_str());
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Data::General
+{
+    void test_mapped_file()
+    {
+        test_mapped_file_case1();
+    }
+}
@@ -1,5 +1,7 @@
+#include <data_gen.h>
 #include <MetaNN/meta_nn.h>
 #include <calculate_tags.h>
+#include <cmath>
 #include <iostream>
 using namespace std;
 using namespace MetaNN;
@@ -83,6 +85,46 @@ namespace
         }
         cout << "done" << endl;
     }
+    void test_zero_data4()
+    {
+        cout << "Test zero data case 4 (consumed as scalar) ...\t";
+        auto x = GenBatchMatrix<CheckElement>(3, 4, 5, -1, 0.1f);
+        ZeroData<CategoryTags::BatchMatrix, CheckElement, CheckDevice> zero(3, 4, 5);
+
+        // adding zero forwards the other operand without a new buffer.
+        auto add = Evaluate(x + zero);
+        assert(LowerAccess(add).RawMemory() == LowerAccess(x).RawMemory());
+        auto sub = Evaluate(x - zero);
+        assert(LowerAccess(sub).RawMemory() == LowerAccess(x).RawMemory());
+
+        auto neg = Evaluate(zero - x);
+        auto mul = Evaluate(zero * x);
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 5; ++j)
+                {
+                    assert(fabs(neg[b](i, j) + x[b](i, j)) < 0.0001f);
+                    assert(mul[b](i, j) == 0);
+                }
+            }
+        }
+
+        auto dot = Evaluate(Dot(x, ZeroData<CategoryTags::BatchMatrix, CheckElement, CheckDevice>(3, 5, 2)));
+        assert(dot.Shape() == Shape<CategoryTags::BatchMatrix>(3, 4, 2));
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 2; ++j)
+                {
+                    assert(dot[b](i, j) == 0);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Data::General
@@ -92,5 +134,6 @@ namespace Test::Data::General
         test_zero_data1();
         test_zero_data2();
         test_zero_data3();
+        test_zero_data4();
     }
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #include <operators/activation/_.h>
 #include <operators/blas/_.h>
 #include <operators/cate_trans/_.h>
+#include <operators/conv/_.h>
 #include <operators/elementwise/_.h>
 #include <operators/loss/_.h>
 #include <operators/mutating/_.h>
@@ -13,6 +14,7 @@ namespace Test::Operators
         Test::Operators::Activation::test();
         Test::Operators::Blas::test();
         Test::Operators::CateTrans::test();
+        Test::Operators::Conv::test();
         Test::Operators::Elwentwise::test();
         Test::Operators::Loss::test();
         Test::Operators::Mutating::test();
@@ -38,6 +38,55 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_relu_case2()
+    {
+        cout << "Test ReLU case 2 (large)\t";
+        auto input = GenBatchMatrix<CheckElement>(2, 301, 119, -30000, 1);
+        auto grad = GenBatchMatrix<CheckElement>(2, 301, 119, 0, 0.001f);
+        auto res = Evaluate(ReLU(input));
+        auto resGrad = Evaluate(ReLUGrad(grad, input));
+
+        auto lowIn = LowerAccess(input);
+        auto lowGrad = LowerAccess(grad);
+        auto lowRes = LowerAccess(res);
+        auto lowResGrad = LowerAccess(resGrad);
+        for (size_t i = 0; i < input.Shape().Count(); ++i)
+        {
+            const bool active = lowIn.RawMemory()[i] > 0;
+            assert(lowRes.RawMemory()[i] == (active ? lowIn.RawMemory()[i] : 0));
+            assert(lowResGrad.RawMemory()[i] == (active ? lowGrad.RawMemory()[i] : 0));
+        }
+        cout << "done" << endl;
+    }
+
+    void test_relu_case3()
+    {
+        cout << "Test ReLU case 3 (vector tail and low precision)\t";
+        // above the parallel threshold, with a count that is not a multiple of any vector width.
+        const size_t count = (1 << 17) + 13;
+        auto input = GenMatrix<CheckElement>(1, count, -1, 0.00001f);
+        auto res = Evaluate(ReLU(input));
+        auto lowIn = LowerAccess(input);
+        auto lowRes = LowerAccess(res);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const CheckElement v = lowIn.RawMemory()[i];
+            assert(lowRes.RawMemory()[i] == (v > 0 ? v : 0));
+        }
+
+        auto half = GenMatrix<Float16>(37, 29, -3, 0.01f);
+        auto halfRes = Evaluate(ReLU(half));
+        for (size_t i = 0; i < 37; ++i)
+        {
+            for (size_t j = 0; j < 29; ++j)
+            {
+                const float v = half(i, j);
+                assert((float)halfRes(i, j) == (v > 0 ? v : 0));
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Activation
@@ -45,6 +94,8 @@ namespace Test::Operators::Activation
     void test_relu()
     {
         test_relu_case1();
+        test_relu_case2();
+        test_relu_case3();
     }
 }
 
@@ -159,6 +159,22 @@ namespace
         }
         cout << "done" << endl;
     }
+    void test_sigmoid_case7()
+    {
+        cout << "Test sigmoid case 7 (wide range, relative error)\t";
+        auto ori = GenMatrix<CheckElement>(40, 50, -50, 0.05);
+        auto res = Evaluate(Sigmoid(ori));
+        for (size_t i = 0; i < 40; ++i)
+        {
+            for (size_t k = 0; k < 50; ++k)
+            {
+                const double x = ori(i, k);
+                const double value = 1 / (1 + exp(-x));
+                assert(fabs(res(i, k) - value) <= 1e-6 * fabs(value) + 1e-30);
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Activation
@@ -171,6 +187,7 @@ namespace Test::Operators::Activation
         test_sigmoid_case4();
         test_sigmoid_case5();
         test_sigmoid_case6();
+        test_sigmoid_case7();
     }
 }
 
@@ -159,6 +159,22 @@ namespace
         }
         cout << "done" << endl;
     }
+    void test_tanh_case7()
+    {
+        cout << "Test tanh case 7 (wide range, relative error)\t";
+        auto ori = GenMatrix<CheckElement>(40, 50, -10, 0.01);
+        auto res = Evaluate(Tanh(ori));
+        for (size_t i = 0; i < 40; ++i)
+        {
+            for (size_t k = 0; k < 50; ++k)
+            {
+                const double x = ori(i, k);
+                const double value = tanh(x);
+                assert(fabs(res(i, k) - value) <= 1e-6 * fabs(value) + 1e-30);
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Activation
@@ -171,6 +187,7 @@ namespace Test::Operators::Activation
         test_tanh_case4();
         test_tanh_case5();
         test_tanh_case6();
+        test_tanh_case7();
     }
 }
 
@@ -166,6 +166,111 @@ namespace
         }
         cout << "done" << endl;
     }
+    void test_dot_case5()
+    {
+        cout << "Test dot case 5 (blocked gemm)\t";
+        // sizes crossing the register, cache and panel block boundaries.
+        const size_t sizes[][3] = {{1, 1, 1}, {7, 17, 3}, {13, 300, 70}, {130, 257, 33}, {250, 40, 129}};
+        for (const auto& size : sizes)
+        {
+            const size_t m = size[0];
+            const size_t k = size[1];
+            const size_t n = size[2];
+            auto in1 = GenMatrix<CheckElement>(m, k, -1, 0.003f);
+            auto in2 = GenMatrix<CheckElement>(k, n, 0.7f, -0.002f);
+            auto res = Evaluate(Dot(in1, in2));
+            assert(res.Shape().RowNum() == m);
+            assert(res.Shape().ColNum() == n);
+
+            for (size_t i = 0; i < m; ++i)
+            {
+                for (size_t j = 0; j < n; ++j)
+                {
+                    double value = 0;
+                    for (size_t l = 0; l < k; ++l)
+                    {
+                        value += (double)in1(i, l) * (double)in2(l, j);
+                    }
+                    assert(fabs(value - res(i, j)) < 0.001 * (1 + fabs(value)));
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+    void test_dot_case6()
+    {
+        cout << "Test dot case 6 (batched, shared operand)\t";
+        auto batch = GenBatchMatrix<CheckElement>(64, 5, 7, -1, 0.01f);
+        auto right = GenMatrix<CheckElement>(7, 9, 0.3f, -0.02f);
+        auto left = GenMatrix<CheckElement>(4, 5, -0.5f, 0.05f);
+
+        auto resRight = Evaluate(Dot(batch, Duplicate(right, Shape<CategoryTags::BatchMatrix>(64, 7, 9))));
+        auto resLeft = Evaluate(Dot(Duplicate(left, Shape<CategoryTags::BatchMatrix>(64, 4, 5)), batch));
+        assert(resRight.Shape() == Shape<CategoryTags::BatchMatrix>(64, 5, 9));
+        assert(resLeft.Shape() == Shape<CategoryTags::BatchMatrix>(64, 4, 7));
+
+        for (size_t b = 0; b < 64; ++b)
+        {
+            auto checkRight = Evaluate(Dot(batch[b], right));
+            for (size_t i = 0; i < 5; ++i)
+            {
+                for (size_t j = 0; j < 9; ++j)
+                {
+                    assert(fabs(checkRight(i, j) - resRight[b](i, j)) < 0.0001f);
+                }
+            }
+            auto checkLeft = Evaluate(Dot(left, batch[b]));
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 7; ++j)
+                {
+                    assert(fabs(checkLeft(i, j) - resLeft[b](i, j)) < 0.0001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+    void test_dot_case7()
+    {
+        cout << "Test dot case 7 (transposed operands)\t";
+        auto a = GenMatrix<CheckElement>(70, 9, -1, 0.01f);
+        auto b = GenMatrix<CheckElement>(70, 13, 0.5f, -0.02f);
+        auto c = GenMatrix<CheckElement>(9, 13, 0.2f, 0.03f);
+
+        auto resLeft = Evaluate(Dot(Transpose(a), b));
+        auto checkLeft = Evaluate(Dot(Evaluate(Transpose(a)), b));
+        auto resRight = Evaluate(Dot(b, Transpose(c)));
+        auto checkRight = Evaluate(Dot(b, Evaluate(Transpose(c))));
+        auto resBoth = Evaluate(Dot(Transpose(c), Transpose(a)));
+        auto checkBoth = Evaluate(Dot(Evaluate(Transpose(c)), Evaluate(Transpose(a))));
+        assert(resLeft.Shape() == checkLeft.Shape());
+        assert(resRight.Shape() == checkRight.Shape());
+        assert(resBoth.Shape() == checkBoth.Shape());
+
+        auto checkMatrix = [](const auto& res, const auto& check)
+        {
+            for (size_t i = 0; i < res.Shape().RowNum(); ++i)
+            {
+                for (size_t j = 0; j < res.Shape().ColNum(); ++j)
+                {
+                    assert(fabs(check(i, j) - res(i, j)) < 0.0001f);
+                }
+            }
+        };
+        checkMatrix(resLeft, checkLeft);
+        checkMatrix(resRight, checkRight);
+        checkMatrix(resBoth, checkBoth);
+
+        auto batch1 = GenBatchMatrix<CheckElement>(4, 6, 5, -1, 0.01f);
+        auto batch2 = GenBatchMatrix<CheckElement>(4, 6, 3, 0.3f, 0.02f);
+        auto resBatch = Evaluate(Dot(Transpose(batch1), batch2));
+        assert(resBatch.Shape() == Shape<CategoryTags::BatchMatrix>(4, 5, 3));
+        for (size_t b = 0; b < 4; ++b)
+        {
+            checkMatrix(resBatch[b], Evaluate(Dot(Evaluate(Transpose(batch1[b])), batch2[b])));
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Blas
@@ -176,5 +281,8 @@ namespace Test::Operators::Blas
         test_dot_case2();
         test_dot_case3();
         test_dot_case4();
+        test_dot_case5();
+        test_dot_case6();
+        test_dot_case7();
     }
 }
\ No newline at end of file
@@ -5,10 +5,12 @@ namespace Test::Operators::CateTrans
     void test_collapse();
     void test_duplicate();
     void test_slice();
+    void test_reshape();
     void test()
     {
         test_collapse();
         test_duplicate();
         test_slice();
+        test_reshape();
     }
 }
\ No newline at end of file
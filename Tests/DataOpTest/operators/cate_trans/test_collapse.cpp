@@ -1,8 +1,10 @@
 #include <data_gen.h>
 #include <MetaNN/meta_nn.h>
 #include <calculate_tags.h>
+#include <chrono>
 #include <cmath>
 #include <iostream>
+#include <vector>
 using namespace std;
 using namespace MetaNN;
 
@@ -654,6 +656,118 @@ namespace
         }
         cout << "done" << endl;
     }
+    // Sums buckets of a batch matrix in double precision and compares with Collapse.
+    void CheckLargeCollapse(size_t batchNum, size_t rowNum, size_t colNum)
+    {
+        BatchMatrix<CheckElement, CheckDevice> ori(batchNum, rowNum, colNum);
+        {
+            auto low = LowerAccess(ori);
+            auto* mem = low.MutableRawMemory();
+            for (size_t i = 0; i < ori.Shape().Count(); ++i)
+            {
+                mem[i] = (CheckElement)(((i * 29) % 97) * 0.01 - 0.48);
+            }
+        }
+        auto eval = Evaluate(Collapse(ori, Shape<CategoryTags::Matrix>(rowNum, colNum)));
+
+        auto low = LowerAccess(ori);
+        const auto* mem = low.RawMemory();
+        const size_t outCount = rowNum * colNum;
+        vector<double> check(outCount, 0);
+        for (size_t b = 0; b < batchNum; ++b)
+        {
+            for (size_t j = 0; j < outCount; ++j)
+            {
+                check[j] += mem[b * outCount + j];
+            }
+        }
+        for (size_t i = 0; i < rowNum; ++i)
+        {
+            for (size_t j = 0; j < colNum; ++j)
+            {
+                assert(fabs(check[i * colNum + j] - eval(i, j)) < 1e-4 * (batchNum + fabs(check[i * colNum + j])));
+            }
+        }
+    }
+
+    void test_large_collapse_case1()
+    {
+        cout << "Test collapse: large batch matrix -> matrix\t";
+        CheckLargeCollapse(4096, 1, 1024);
+        CheckLargeCollapse(4096, 1, 3);
+        CheckLargeCollapse(1000, 7, 37);
+        CheckLargeCollapse(33, 65, 129);
+        CheckLargeCollapse(1, 5, 300);
+        cout << "done" << endl;
+    }
+
+    void test_large_collapse_case2()
+    {
+        cout << "Test collapse: large matrix -> scalar\t";
+        Matrix<CheckElement, CheckDevice> ori(1000, 999);
+        {
+            auto low = LowerAccess(ori);
+            auto* mem = low.MutableRawMemory();
+            for (size_t i = 0; i < ori.Shape().Count(); ++i)
+            {
+                mem[i] = (CheckElement)(((i * 13) % 31) * 0.01);
+            }
+        }
+        auto eval = Evaluate(Collapse(ori, Shape<CategoryTags::Scalar>()));
+
+        double check = 0;
+        for (size_t i = 0; i < ori.Shape().Count(); ++i)
+        {
+            check += (((i * 13) % 31) * 0.01);
+        }
+        assert(fabs(check - eval.Value()) < 1e-5 * check);
+        cout << "done" << endl;
+    }
+
+    // Collapse of a batch of 1024-element bias gradients against the former single-threaded
+    // scalar loop. Only reports the timings.
+    void test_collapse_benchmark()
+    {
+        cout << "Benchmark collapse: batch matrix (1 x 1024) -> matrix" << endl;
+        using Clock = std::chrono::steady_clock;
+        constexpr size_t colNum = 1024;
+        for (size_t batchNum : {16, 64, 256, 1024, 4096})
+        {
+            auto ori = GenBatchMatrix<CheckElement>(batchNum, 1, colNum, 0, 0.001f);
+            const size_t repeat = std::max<size_t>(1, (1 << 22) / (batchNum * colNum));
+
+            auto low = LowerAccess(ori);
+            const auto* mem = low.RawMemory();
+            vector<CheckElement> ref(colNum);
+            auto begin = Clock::now();
+            for (size_t r = 0; r < repeat; ++r)
+            {
+                std::copy(mem, mem + colNum, ref.begin());
+                for (size_t b = 1; b < batchNum; ++b)
+                {
+                    for (size_t j = 0; j < colNum; ++j)
+                    {
+                        ref[j] += mem[b * colNum + j];
+                    }
+                }
+            }
+            const double loopTime = std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / repeat;
+
+            Matrix<CheckElement, CheckDevice> res;
+            begin = Clock::now();
+            for (size_t r = 0; r < repeat; ++r)
+            {
+                res = Evaluate(Collapse(ori, Shape<CategoryTags::Matrix>(1, colNum)));
+            }
+            const double collapseTime = std::chrono::duration<double, std::micro>(Clock::now() - begin).count() / repeat;
+
+            for (size_t j = 0; j < colNum; ++j)
+            {
+                assert(fabs(ref[j] - res(0, j)) < 1e-4 * (1 + fabs(ref[j])));
+            }
+            cout << "  batch " << batchNum << ":\tloop " << loopTime << " us\tcollapse " << collapseTime << " us" << endl;
+        }
+    }
 }
 
 namespace Test::Operators::CateTrans
@@ -686,5 +800,9 @@ namespace Test::Operators::CateTrans
         test_3d_array_collapse_case2();
         test_3d_array_collapse_case3();
         test_3d_array_collapse_case4();
+
+        test_large_collapse_case1();
+        test_large_collapse_case2();
+        test_collapse_benchmark();
     }
 }
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    void test_reshape_case1()
+    {
+        cout << "Test reshape case 1 (matrix <-> batch matrix)\t";
+        auto ori = GenMatrix<CheckElement>(6, 4);
+        auto res = Reshape(ori, Shape<CategoryTags::Batch<CategoryTags::Matrix>>(3, 2, 4));
+        static_assert(IsBatchMatrix<decltype(res)>);
+        assert(LowerAccess(res).RawMemory() == LowerAccess(ori).RawMemory());
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    assert(res[b](i, j) == ori(b * 2 + i, j));
+                }
+            }
+        }
+
+        auto back = Reshape(res, Shape<CategoryTags::Matrix>(3, 8));
+        static_assert(IsMatrix<decltype(back)>);
+        assert(LowerAccess(back).RawMemory() == LowerAccess(ori).RawMemory());
+        for (size_t i = 0; i < 3; ++i)
+        {
+            for (size_t j = 0; j < 8; ++j)
+            {
+                assert(back(i, j) == ori(i * 2 + j / 4, j % 4));
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_reshape_case2()
+    {
+        cout << "Test reshape case 2 (3d array / batch matrix sequence -> matrix)\t";
+        auto ori = GenThreeDArray<CheckElement>(2, 3, 4);
+        auto res = Reshape(ori, Shape<CategoryTags::Matrix>(6, 4));
+        static_assert(IsMatrix<decltype(res)>);
+        for (size_t p = 0; p < 2; ++p)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t j = 0; j < 4; ++j)
+                {
+                    assert(res(p * 3 + i, j) == ori(p, i, j));
+                }
+            }
+        }
+
+        auto seq = GenBatchMatrixSequence<CheckElement>(std::vector{3, 1, 2}, 2, 5);
+        auto flat = Reshape(seq, Shape<CategoryTags::Matrix>(12, 5));
+        static_assert(IsMatrix<decltype(flat)>);
+        assert(LowerAccess(flat).RawMemory() == LowerAccess(seq).RawMemory());
+        CheckElement value = 0;
+        for (size_t i = 0; i < 12; ++i)
+        {
+            for (size_t j = 0; j < 5; ++j)
+            {
+                assert(flat(i, j) == value);
+                value += 1;
+            }
+        }
+
+        bool exceptionCatched = false;
+        try
+        {
+            Reshape(ori, Shape<CategoryTags::Matrix>(5, 5));
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+        cout << "done" << endl;
+    }
+
+    void test_reshape_case3()
+    {
+        cout << "Test reshape case 3 (operator)\t";
+        auto ori = GenMatrix<CheckElement>(4, 6, -1, 0.1f);
+        auto op = Reshape(Tanh(ori), Shape<CategoryTags::Batch<CategoryTags::Matrix>>(2, 2, 6));
+        static_assert(IsBatchMatrix<decltype(op)>);
+        assert(op.Shape().BatchNum() == 2);
+
+        auto res = Evaluate(op);
+        static_assert(IsBatchMatrix<decltype(res)>);
+        for (size_t b = 0; b < 2; ++b)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                for (size_t j = 0; j < 6; ++j)
+                {
+                    assert(fabs(res[b](i, j) - tanh(ori(b * 2 + i, j))) < 0.001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Operators::CateTrans
+{
+    void test_reshape()
+    {
+        test_reshape_case1();
+        test_reshape_case2();
+        test_reshape_case3();
+    }
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+namespace Test::Operators::Conv
+{
+    void test_conv2d();
+    void test_pool2d();
+    void test()
+    {
+        test_conv2d();
+        test_pool2d();
+    }
+}
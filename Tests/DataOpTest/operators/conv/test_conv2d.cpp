@@ -0,0 +1,290 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    auto MakeParams(size_t row, size_t col)
+    {
+        return VarTypeDict<ConvParams::RowNum, ConvParams::ColNum>::Create()
+                   .Set<ConvParams::RowNum>(row)
+                   .Set<ConvParams::ColNum>(col);
+    }
+
+    template <typename TInput, typename TKernel, typename TOutput>
+    void CheckConv(const TInput& in, const TKernel& kernel, const TOutput& out,
+                   size_t padRow, size_t padCol, size_t strideRow, size_t strideCol)
+    {
+        const size_t C = in.Shape().PageNum();
+        const size_t H = in.Shape().RowNum();
+        const size_t W = in.Shape().ColNum();
+        const size_t KH = kernel.Shape().Cardinal().RowNum();
+        const size_t KW = kernel.Shape().Cardinal().ColNum();
+        assert(out.Shape().PageNum() == kernel.Shape().Length());
+
+        for (size_t k = 0; k < out.Shape().PageNum(); ++k)
+        {
+            for (size_t oy = 0; oy < out.Shape().RowNum(); ++oy)
+            {
+                for (size_t ox = 0; ox < out.Shape().ColNum(); ++ox)
+                {
+                    double check = 0;
+                    for (size_t c = 0; c < C; ++c)
+                    {
+                        for (size_t i = 0; i < KH; ++i)
+                        {
+                            for (size_t j = 0; j < KW; ++j)
+                            {
+                                const long y = (long)(oy * strideRow + i) - (long)padRow;
+                                const long x = (long)(ox * strideCol + j) - (long)padCol;
+                                if ((y < 0) || (y >= (long)H) || (x < 0) || (x >= (long)W)) continue;
+                                check += in(c, y, x) * kernel[k](c, i, j);
+                            }
+                        }
+                    }
+                    assert(fabs(out(k, oy, ox) - check) < 0.001 * (1 + fabs(check)));
+                }
+            }
+        }
+    }
+
+    template <typename TData1, typename TData2>
+    double InnerProduct(const TData1& d1, const TData2& d2)
+    {
+        assert(d1.Shape() == d2.Shape());
+        auto low1 = LowerAccess(d1);
+        auto low2 = LowerAccess(d2);
+        const auto* mem1 = low1.RawMemory();
+        const auto* mem2 = low2.RawMemory();
+        double res = 0;
+        for (size_t i = 0; i < d1.Shape().Count(); ++i)
+        {
+            res += (double)mem1[i] * mem2[i];
+        }
+        return res;
+    }
+
+    void test_conv2d_case1()
+    {
+        cout << "Test conv2d case 1 (default padding)\t";
+        auto in = GenThreeDArray<CheckElement>(3, 7, 6, -1, 0.01f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(4, 3, 3, 2, -50, 0.02f);
+
+        auto op = DefaultConv(in, kernel, MakeParams(1, 0), MakeParams(2, 1), MakeParams(1, 1));
+        static_assert(IsThreeDArray<decltype(op)>);
+        assert(op.Shape() == Shape<CategoryTags::ThreeDArray>(4, 8, 6));
+
+        auto res = Evaluate(op);
+        assert(res.Shape() == op.Shape());
+        CheckConv(in, kernel, res, 1, 0, 1, 1);
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case2()
+    {
+        cout << "Test conv2d case 2 (same padding, strides)\t";
+        auto in = GenThreeDArray<CheckElement>(2, 9, 10, -1, 0.01f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(5, 2, 3, 4, -30, 0.02f);
+
+        auto op = SameConv(in, kernel, MakeParams(2, 3));
+        assert(op.Shape() == Shape<CategoryTags::ThreeDArray>(5, 5, 4));
+
+        auto res = Evaluate(op);
+        // rows: pad 2 = 1 + 1, cols: pad 3 = 1 + 2
+        CheckConv(in, kernel, res, 1, 1, 2, 3);
+
+        auto same = Evaluate(SameConv(in, kernel, MakeParams(1, 1)));
+        assert(same.Shape() == Shape<CategoryTags::ThreeDArray>(5, 9, 10));
+        CheckConv(in, kernel, same, 1, 1, 1, 1);
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case3()
+    {
+        cout << "Test conv2d case 3 (batch)\t";
+        auto in = GenBatchThreeDArray<CheckElement>(3, 4, 6, 5, -1, 0.005f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(6, 4, 3, 3, -100, 0.01f);
+
+        auto op = SameConv(in, kernel, MakeParams(1, 1));
+        static_assert(IsBatchThreeDArray<decltype(op)>);
+        assert(op.Shape() == Shape<CategoryTags::BatchThreeDArray>(3, 6, 6, 5));
+
+        auto res = Evaluate(op);
+        for (size_t b = 0; b < 3; ++b)
+        {
+            CheckConv(in[b], kernel, res[b], 1, 1, 1, 1);
+        }
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case4()
+    {
+        cout << "Test conv2d case 4 (pointwise)\t";
+        auto in = GenBatchThreeDArray<CheckElement>(2, 8, 5, 7, -1, 0.003f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(3, 8, 1, 1, -12, 0.1f);
+
+        auto res = Evaluate(DefaultConv(in, kernel, MakeParams(0, 0), MakeParams(0, 0), MakeParams(1, 1)));
+        assert(res.Shape() == Shape<CategoryTags::BatchThreeDArray>(2, 3, 5, 7));
+        for (size_t b = 0; b < 2; ++b)
+        {
+            CheckConv(in[b], kernel, res[b], 0, 0, 1, 1);
+        }
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case5()
+    {
+        cout << "Test conv2d case 5 (invalid input)\t";
+        auto in = GenThreeDArray<CheckElement>(3, 4, 4);
+        bool thrown = false;
+        try
+        {
+            auto kernel = GenThreeDArraySequence<CheckElement>(2, 2, 3, 3);
+            DefaultConv(in, kernel, MakeParams(0, 0), MakeParams(0, 0), MakeParams(1, 1));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        thrown = false;
+        try
+        {
+            auto kernel = GenThreeDArraySequence<CheckElement>(2, 3, 5, 3);
+            DefaultConv(in, kernel, MakeParams(0, 0), MakeParams(0, 0), MakeParams(1, 1));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+        cout << "done" << endl;
+    }
+
+    // <Conv(x, W), g> = <x, GradInput(g, W)> = <W, GradKernel(g, x)>
+    template <typename TInput, typename TKernel, typename TStride>
+    void CheckGrad(const TInput& in, const TKernel& kernel, const TStride& strides)
+    {
+        auto op = SameConv(in, kernel, strides);
+        auto out = Evaluate(op);
+
+        using GradType = PrincipalDataType<DataCategory<TInput>, CheckElement, CheckDevice>;
+        GradType grad(out.Shape());
+        {
+            auto low = LowerAccess(grad);
+            auto* mem = low.MutableRawMemory();
+            for (size_t i = 0; i < grad.Shape().Count(); ++i)
+            {
+                mem[i] = (CheckElement)(((i * 7) % 13) * 0.1 - 0.6);
+            }
+        }
+        const double forward = InnerProduct(out, grad);
+
+        auto gradIn = Evaluate(Conv2DGradInput(grad, kernel, op.AuxParams(), in.Shape()));
+        assert(gradIn.Shape() == in.Shape());
+        const double dataSide = InnerProduct(in, gradIn);
+        assert(fabs(forward - dataSide) < 0.001 * (1 + fabs(forward)));
+
+        auto gradKernel = Evaluate(Conv2DGradKernel(grad, in, op.AuxParams(), kernel.Shape()));
+        static_assert(IsThreeDArraySequence<decltype(gradKernel)>);
+        assert(gradKernel.Shape() == kernel.Shape());
+        const double kernelSide = InnerProduct(kernel, gradKernel);
+        assert(fabs(forward - kernelSide) < 0.001 * (1 + fabs(forward)));
+    }
+
+    void test_conv2d_case6()
+    {
+        cout << "Test conv2d case 6 (gradients)\t";
+        CheckGrad(GenThreeDArray<CheckElement>(3, 7, 6, -1, 0.01f),
+                  GenThreeDArraySequence<CheckElement>(4, 3, 3, 2, -50, 0.02f),
+                  MakeParams(1, 1));
+        CheckGrad(GenBatchThreeDArray<CheckElement>(3, 2, 9, 8, -1, 0.004f),
+                  GenThreeDArraySequence<CheckElement>(5, 2, 3, 3, -40, 0.02f),
+                  MakeParams(2, 3));
+        CheckGrad(GenBatchThreeDArray<CheckElement>(2, 6, 4, 5, -1, 0.01f),
+                  GenThreeDArraySequence<CheckElement>(3, 6, 1, 1, -9, 0.1f),
+                  MakeParams(1, 1));
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case7()
+    {
+        cout << "Test conv2d case 7 (kernel gradient values)\t";
+        auto in = GenBatchThreeDArray<CheckElement>(2, 2, 4, 4, -1, 0.05f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(1, 2, 2, 2);
+        auto op = DefaultConv(in, kernel, MakeParams(0, 0), MakeParams(0, 0), MakeParams(2, 2));
+        assert(op.Shape() == Shape<CategoryTags::BatchThreeDArray>(2, 1, 2, 2));
+
+        // an all-one output gradient sums the input over the positions each weight touches.
+        BatchThreeDArray<CheckElement, CheckDevice> grad(2, 1, 2, 2);
+        for (size_t b = 0; b < 2; ++b)
+            for (size_t i = 0; i < 2; ++i)
+                for (size_t j = 0; j < 2; ++j)
+                    grad.SetValue(b, 0, i, j, 1);
+
+        auto res = Evaluate(Conv2DGradKernel(grad, in, op.AuxParams(), kernel.Shape()));
+        for (size_t c = 0; c < 2; ++c)
+        {
+            for (size_t i = 0; i < 2; ++i)
+            {
+                for (size_t j = 0; j < 2; ++j)
+                {
+                    double check = 0;
+                    for (size_t b = 0; b < 2; ++b)
+                        for (size_t oy = 0; oy < 2; ++oy)
+                            for (size_t ox = 0; ox < 2; ++ox)
+                                check += in[b](c, oy * 2 + i, ox * 2 + j);
+                    assert(fabs(res[0](c, i, j) - check) < 0.001);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_conv2d_case8()
+    {
+        cout << "Test conv2d case 8 (channel-last input)\t";
+        auto in = GenThreeDArray<CheckElement>(6, 9, 10, -1, 0.01f);
+        auto kernel = GenThreeDArraySequence<CheckElement>(5, 6, 3, 4, -30, 0.02f);
+        ChannelLastThreeDArray<CheckElement, CheckDevice> inCL(in);
+
+        auto op = SameConv(inCL, kernel, MakeParams(2, 3));
+        static_assert(IsThreeDArray<decltype(op)>);
+        auto res = Evaluate(op);
+        assert(res.Shape() == Shape<CategoryTags::ThreeDArray>(5, 5, 4));
+        CheckConv(in, kernel, res, 1, 1, 2, 3);
+
+        auto batch = GenBatchThreeDArray<CheckElement>(3, 8, 5, 7, -1, 0.003f);
+        BatchChannelLastThreeDArray<CheckElement, CheckDevice> batchCL(batch);
+        auto pointKernel = GenThreeDArraySequence<CheckElement>(3, 8, 1, 1, -12, 0.1f);
+        auto pointRes = Evaluate(DefaultConv(batchCL, pointKernel, MakeParams(0, 0), MakeParams(0, 0), MakeParams(1, 1)));
+        auto padKernel = GenThreeDArraySequence<CheckElement>(4, 8, 2, 3, -50, 0.02f);
+        auto padRes = Evaluate(DefaultConv(batchCL, padKernel, MakeParams(1, 0), MakeParams(2, 1), MakeParams(1, 2)));
+        for (size_t b = 0; b < 3; ++b)
+        {
+            CheckConv(batch[b], pointKernel, pointRes[b], 0, 0, 1, 1);
+            CheckConv(batch[b], padKernel, padRes[b], 1, 0, 1, 2);
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Operators::Conv
+{
+    void test_conv2d()
+    {
+        test_conv2d_case1();
+        test_conv2d_case2();
+        test_conv2d_case3();
+        test_conv2d_case4();
+        test_conv2d_case5();
+        test_conv2d_case6();
+        test_conv2d_case7();
+        test_conv2d_case8();
+    }
+}
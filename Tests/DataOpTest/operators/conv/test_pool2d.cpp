@@ -0,0 +1,254 @@
+#include <data_gen.h>
+#include <MetaNN/meta_nn.h>
+#include <calculate_tags.h>
+#include <cmath>
+#include <iostream>
+#include <vector>
+using namespace std;
+using namespace MetaNN;
+
+namespace
+{
+    auto MakeParams(size_t row, size_t col)
+    {
+        return VarTypeDict<ConvParams::RowNum, ConvParams::ColNum>::Create()
+                   .Set<ConvParams::RowNum>(row)
+                   .Set<ConvParams::ColNum>(col);
+    }
+
+    // deterministic values without long monotonic runs, so that the maxima move around.
+    template <typename TData>
+    void Scramble(TData& data)
+    {
+        auto low = LowerAccess(data);
+        auto* mem = low.MutableRawMemory();
+        for (size_t i = 0; i < data.Shape().Count(); ++i)
+        {
+            mem[i] = (CheckElement)(((i * 37) % 101) * 0.01 - 0.5);
+        }
+    }
+
+    template <typename TInput, typename TOutput>
+    void CheckPool(bool isMax, const TInput& in, const TOutput& out,
+                   size_t windowRow, size_t windowCol, size_t strideRow, size_t strideCol)
+    {
+        for (size_t p = 0; p < out.Shape().PageNum(); ++p)
+        {
+            for (size_t oy = 0; oy < out.Shape().RowNum(); ++oy)
+            {
+                for (size_t ox = 0; ox < out.Shape().ColNum(); ++ox)
+                {
+                    double check = isMax ? -1e30 : 0;
+                    for (size_t i = 0; i < windowRow; ++i)
+                    {
+                        for (size_t j = 0; j < windowCol; ++j)
+                        {
+                            const double v = in(p, oy * strideRow + i, ox * strideCol + j);
+                            check = isMax ? std::max(check, v) : check + v;
+                        }
+                    }
+                    if (!isMax) check /= windowRow * windowCol;
+                    assert(fabs(out(p, oy, ox) - check) < 0.0001);
+                }
+            }
+        }
+    }
+
+    void test_pool2d_case1()
+    {
+        cout << "Test pool2d case 1 (max pooling)\t";
+        ThreeDArray<CheckElement, CheckDevice> in(3, 9, 37);
+        Scramble(in);
+
+        auto op = MaxPool(in, MakeParams(3, 2), MakeParams(1, 1));
+        static_assert(IsThreeDArray<decltype(op)>);
+        assert(op.Shape() == Shape<CategoryTags::ThreeDArray>(3, 7, 36));
+        CheckPool(true, in, Evaluate(op), 3, 2, 1, 1);
+
+        auto res = Evaluate(MaxPool(in, MakeParams(2, 3), MakeParams(2, 3)));
+        assert(res.Shape() == Shape<CategoryTags::ThreeDArray>(3, 4, 12));
+        CheckPool(true, in, res, 2, 3, 2, 3);
+        cout << "done" << endl;
+    }
+
+    void test_pool2d_case2()
+    {
+        cout << "Test pool2d case 2 (average pooling)\t";
+        ThreeDArray<CheckElement, CheckDevice> in(2, 8, 21);
+        Scramble(in);
+
+        auto res = Evaluate(AvgPool(in, MakeParams(2, 2), MakeParams(2, 1)));
+        assert(res.Shape() == Shape<CategoryTags::ThreeDArray>(2, 4, 20));
+        CheckPool(false, in, res, 2, 2, 2, 1);
+
+        res = Evaluate(AvgPool(in, MakeParams(3, 3), MakeParams(2, 2)));
+        assert(res.Shape() == Shape<CategoryTags::ThreeDArray>(2, 3, 10));
+        CheckPool(false, in, res, 3, 3, 2, 2);
+        cout << "done" << endl;
+    }
+
+    void test_pool2d_case3()
+    {
+        cout << "Test pool2d case 3 (batch)\t";
+        BatchThreeDArray<CheckElement, CheckDevice> in(4, 16, 32, 32);
+        Scramble(in);
+
+        auto maxOp = MaxPool(in, MakeParams(2, 2), MakeParams(2, 2));
+        static_assert(IsBatchThreeDArray<decltype(maxOp)>);
+        auto avgOp = AvgPool(in, MakeParams(2, 2), MakeParams(1, 1));
+
+        auto maxHandle = maxOp.EvalRegister();
+        auto avgHandle = avgOp.EvalRegister();
+        EvalPlan<CheckDevice>::Inst().Eval();
+
+        const auto& maxRes = maxHandle.Data();
+        const auto& avgRes = avgHandle.Data();
+        assert(maxRes.Shape() == Shape<CategoryTags::BatchThreeDArray>(4, 16, 16, 16));
+        assert(avgRes.Shape() == Shape<CategoryTags::BatchThreeDArray>(4, 16, 31, 31));
+        for (size_t b = 0; b < 4; ++b)
+        {
+            CheckPool(true, in[b], maxRes[b], 2, 2, 2, 2);
+            CheckPool(false, in[b], avgRes[b], 2, 2, 1, 1);
+        }
+        cout << "done" << endl;
+    }
+
+    void test_pool2d_case4()
+    {
+        cout << "Test pool2d case 4 (max pooling gradient)\t";
+        BatchThreeDArray<CheckElement, CheckDevice> in(2, 3, 7, 9);
+        Scramble(in);
+        auto op = MaxPool(in, MakeParams(3, 3), MakeParams(2, 2));
+        auto grad = GenBatchThreeDArray<CheckElement>(2, 3, 3, 4, 1, 1);
+
+        auto res = Evaluate(MaxPoolGrad(grad, in, op.AuxParams()));
+        assert(res.Shape() == in.Shape());
+
+        vector<double> check(2 * 3 * 7 * 9, 0);
+        for (size_t b = 0; b < 2; ++b)
+        {
+            for (size_t p = 0; p < 3; ++p)
+            {
+                for (size_t oy = 0; oy < 3; ++oy)
+                {
+                    for (size_t ox = 0; ox < 4; ++ox)
+                    {
+                        size_t y = oy * 2, x = ox * 2;
+                        for (size_t i = 0; i < 3; ++i)
+                            for (size_t j = 0; j < 3; ++j)
+                                if (in[b](p, oy * 2 + i, ox * 2 + j) > in[b](p, y, x))
+                                {
+                                    y = oy * 2 + i;
+                                    x = ox * 2 + j;
+                                }
+                        check[((b * 3 + p) * 7 + y) * 9 + x] += grad[b](p, oy, ox);
+                    }
+                }
+            }
+        }
+        for (size_t b = 0; b < 2; ++b)
+            for (size_t p = 0; p < 3; ++p)
+                for (size_t i = 0; i < 7; ++i)
+                    for (size_t j = 0; j < 9; ++j)
+                        assert(fabs(res[b](p, i, j) - check[((b * 3 + p) * 7 + i) * 9 + j]) < 0.0001);
+        cout << "done" << endl;
+    }
+
+    // <AvgPool(x), g> = <x, AvgPoolGrad(g)>
+    void test_pool2d_case5()
+    {
+        cout << "Test pool2d case 5 (average pooling gradient)\t";
+        auto check = [](size_t windowRow, size_t windowCol, size_t strideRow, size_t strideCol)
+        {
+            BatchThreeDArray<CheckElement, CheckDevice> in(3, 2, 10, 19);
+            Scramble(in);
+            auto op = AvgPool(in, MakeParams(windowRow, windowCol), MakeParams(strideRow, strideCol));
+            auto out = Evaluate(op);
+
+            const auto& outShape = out.Shape();
+            auto grad = GenBatchThreeDArray<CheckElement>(outShape.BatchNum(), outShape.PageNum(),
+                                                          outShape.RowNum(), outShape.ColNum(), -1, 0.01f);
+            auto res = Evaluate(AvgPoolGrad(grad, op.AuxParams(), in.Shape()));
+            assert(res.Shape() == in.Shape());
+
+            auto low1 = LowerAccess(out); auto low2 = LowerAccess(grad);
+            auto low3 = LowerAccess(in);  auto low4 = LowerAccess(res);
+            double lhs = 0, rhs = 0;
+            for (size_t i = 0; i < outShape.Count(); ++i)
+                lhs += (double)low1.RawMemory()[i] * low2.RawMemory()[i];
+            for (size_t i = 0; i < in.Shape().Count(); ++i)
+                rhs += (double)low3.RawMemory()[i] * low4.RawMemory()[i];
+            assert(fabs(lhs - rhs) < 0.001 * (1 + fabs(lhs)));
+        };
+        check(2, 2, 2, 2);
+        check(3, 2, 1, 1);
+        check(3, 3, 2, 3);
+        cout << "done" << endl;
+    }
+
+    void test_pool2d_case6()
+    {
+        cout << "Test pool2d case 6 (invalid window)\t";
+        ThreeDArray<CheckElement, CheckDevice> in(2, 3, 3);
+        bool thrown = false;
+        try
+        {
+            MaxPool(in, MakeParams(4, 2), MakeParams(1, 1));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+
+        thrown = false;
+        try
+        {
+            AvgPool(in, MakeParams(2, 2), MakeParams(0, 1));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        assert(thrown);
+        cout << "done" << endl;
+    }
+
+    void test_pool2d_case7()
+    {
+        cout << "Test pool2d case 7 (channel-last input)\t";
+        ThreeDArray<CheckElement, CheckDevice> in(20, 9, 11);
+        Scramble(in);
+        ChannelLastThreeDArray<CheckElement, CheckDevice> inCL(in);
+        CheckPool(true, in, Evaluate(MaxPool(inCL, MakeParams(3, 2), MakeParams(1, 1))), 3, 2, 1, 1);
+        CheckPool(false, in, Evaluate(AvgPool(inCL, MakeParams(2, 3), MakeParams(2, 3))), 2, 3, 2, 3);
+
+        BatchThreeDArray<CheckElement, CheckDevice> batch(4, 16, 32, 32);
+        Scramble(batch);
+        BatchChannelLastThreeDArray<CheckElement, CheckDevice> batchCL(batch);
+        auto maxRes = Evaluate(MaxPool(batchCL, MakeParams(2, 2), MakeParams(2, 2)));
+        auto avgRes = Evaluate(AvgPool(batchCL, MakeParams(3, 3), MakeParams(1, 2)));
+        assert(maxRes.Shape() == Shape<CategoryTags::BatchThreeDArray>(4, 16, 16, 16));
+        assert(avgRes.Shape() == Shape<CategoryTags::BatchThreeDArray>(4, 16, 30, 15));
+        for (size_t b = 0; b < 4; ++b)
+        {
+            CheckPool(true, batch[b], maxRes[b], 2, 2, 2, 2);
+            CheckPool(false, batch[b], avgRes[b], 3, 3, 1, 2);
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Operators::Conv
+{
+    void test_pool2d()
+    {
+        test_pool2d_case1();
+        test_pool2d_case2();
+        test_pool2d_case3();
+        test_pool2d_case4();
+        test_pool2d_case5();
+        test_pool2d_case6();
+        test_pool2d_case7();
+    }
+}
@@ -95,6 +95,89 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_add_case4()
+    {
+        cout << "Test add case 4 (broadcast)\t";
+        auto bias = GenMatrix<CheckElement>(4, 7, -10, 0.5);
+        auto batch = GenBatchMatrix<CheckElement>(5, 4, 7, 3, -0.2);
+        auto res1 = Evaluate(batch + Duplicate(bias, batch.Shape()));
+        auto res2 = Evaluate(Duplicate(bias, batch.Shape()) + batch);
+        static_assert(IsBatchMatrix<decltype(res1)>);
+        assert(res1.Shape() == batch.Shape());
+        for (size_t b = 0; b < 5; ++b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t k = 0; k < 7; ++k)
+                {
+                    auto check = batch[b](i, k) + bias(i, k);
+                    assert(fabs(check - res1[b](i, k)) < 0.001f);
+                    assert(fabs(check - res2[b](i, k)) < 0.001f);
+                }
+            }
+        }
+
+        auto ori = GenMatrix<CheckElement>(6, 3, 1, 2);
+        auto res3 = Evaluate(ori + Duplicate(Scalar<CheckElement, CheckDevice>(2.5), ori.Shape()));
+        for (size_t i = 0; i < 6; ++i)
+        {
+            for (size_t k = 0; k < 3; ++k)
+            {
+                assert(fabs(ori(i, k) + 2.5 - res3(i, k)) < 0.001f);
+            }
+        }
+
+        auto arr1 = GenThreeDArray<CheckElement>(2, 3, 4, 1, 0.5);
+        auto arr2 = GenThreeDArray<CheckElement>(2, 3, 4, -3, 0.25);
+        Shape<CategoryTags::BatchThreeDArray> shape(3, 2, 3, 4);
+        auto res4 = Evaluate(Duplicate(arr1, shape) + Duplicate(arr2, shape));
+        assert(res4.Shape() == shape);
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t p = 0; p < 2; ++p)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    for (size_t k = 0; k < 4; ++k)
+                    {
+                        auto check = arr1(p, i, k) + arr2(p, i, k);
+                        assert(fabs(check - res4[b](p, i, k)) < 0.001f);
+                    }
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    // large enough to be split over threads, with a tail shorter than a vector.
+    void test_add_case5()
+    {
+        cout << "Test add case 5 (large)\t";
+        auto ori1 = GenBatchMatrix<CheckElement>(3, 157, 151, -50, 0.001f);
+        auto ori2 = GenBatchMatrix<CheckElement>(3, 157, 151, 1, 0.0007f);
+        auto bias = GenMatrix<CheckElement>(157, 151, 2, -0.0003f);
+        auto res1 = Evaluate(ori1 + ori2);
+        auto res2 = Evaluate(ori1 + Duplicate(bias, ori1.Shape()));
+        auto res3 = Evaluate(ori1 + 2);
+
+        const size_t count = ori1.Shape().Count();
+        const size_t biasCount = bias.Shape().Count();
+        auto low1 = LowerAccess(ori1);
+        auto low2 = LowerAccess(ori2);
+        auto lowBias = LowerAccess(bias);
+        auto lowRes1 = LowerAccess(res1);
+        auto lowRes2 = LowerAccess(res2);
+        auto lowRes3 = LowerAccess(res3);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto in1 = low1.RawMemory()[i];
+            assert(fabs(in1 + low2.RawMemory()[i] - lowRes1.RawMemory()[i]) < 0.001f);
+            assert(fabs(in1 + lowBias.RawMemory()[i % biasCount] - lowRes2.RawMemory()[i]) < 0.001f);
+            assert(fabs(in1 + 2 - lowRes3.RawMemory()[i]) < 0.001f);
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -104,5 +187,7 @@ namespace Test::Operators::Elwentwise
         test_add_case1();
         test_add_case2();
         test_add_case3();
+        test_add_case4();
+        test_add_case5();
     }
 }
\ No newline at end of file
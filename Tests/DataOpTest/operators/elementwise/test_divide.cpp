@@ -168,6 +168,27 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_divide_case8()
+    {
+        cout << "Test divide case 8 (broadcast)\t";
+        auto norm = GenMatrix<CheckElement>(4, 5, 1, 0.5);
+        auto batch = GenBatchMatrix<CheckElement>(6, 4, 5, -3, 0.1);
+        auto res = Evaluate(batch / Duplicate(norm, batch.Shape()));
+        assert(res.Shape() == batch.Shape());
+        for (size_t b = 0; b < 6; ++b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t k = 0; k < 5; ++k)
+                {
+                    auto check = batch[b](i, k) / norm(i, k);
+                    assert(fabs(check - res[b](i, k)) < 0.001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -183,5 +204,6 @@ namespace Test::Operators::Elwentwise
         // divid by number
         test_divide_case6();
         test_divide_case7();
+        test_divide_case8();
     }
 }
\ No newline at end of file
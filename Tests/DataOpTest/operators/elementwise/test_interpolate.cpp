@@ -50,6 +50,29 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_interpolate_case3()
+    {
+        cout << "Test interpolate case 3 (broadcast)\t";
+        auto ori1 = GenMatrix<CheckElement>(3, 7, -10, 0.5);
+        auto ori2 = GenBatchMatrix<CheckElement>(4, 3, 7, 1, 0.25);
+        auto lambda = GenMatrix<CheckElement>(3, 7, 0.1, 0.03);
+        auto res = Evaluate(Interpolate(Duplicate(ori1, ori2.Shape()), ori2, Duplicate(lambda, ori2.Shape())));
+        static_assert(IsBatchMatrix<decltype(res)>);
+        assert(res.Shape() == ori2.Shape());
+        for (size_t b = 0; b < 4; ++b)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t k = 0; k < 7; ++k)
+                {
+                    auto check = ori1(i, k) * lambda(i, k) + ori2[b](i, k) * (1 - lambda(i, k));
+                    assert(fabs(check - res[b](i, k)) < 0.001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -58,5 +81,6 @@ namespace Test::Operators::Elwentwise
     {
         test_interpolate_case1();
         test_interpolate_case2();
+        test_interpolate_case3();
     }
 }
\ No newline at end of file
@@ -147,6 +147,27 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_multiply_case6()
+    {
+        cout << "Test multiply case 6 (broadcast)\t";
+        auto scale = GenMatrix<CheckElement>(5, 6, 0.5, 0.1);
+        auto batch = GenBatchMatrix<CheckElement>(3, 5, 6, -2, 0.2);
+        auto res = Evaluate(Duplicate(scale, batch.Shape()) * batch);
+        assert(res.Shape() == batch.Shape());
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t i = 0; i < 5; ++i)
+            {
+                for (size_t k = 0; k < 6; ++k)
+                {
+                    auto check = scale(i, k) * batch[b](i, k);
+                    assert(fabs(check - res[b](i, k)) < 0.001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -158,5 +179,6 @@ namespace Test::Operators::Elwentwise
         test_multiply_case3();
         test_multiply_case4();
         test_multiply_case5();
+        test_multiply_case6();
     }
 }
\ No newline at end of file
@@ -108,6 +108,23 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_sign_case4()
+    {
+        cout << "Test sign case 4 (large)\t";
+        auto ori = GenMatrix<CheckElement>(263, 271, -35000, 1);
+        auto res = Evaluate(Sign(ori));
+
+        auto lowOri = LowerAccess(ori);
+        auto lowRes = LowerAccess(res);
+        for (size_t i = 0; i < ori.Shape().Count(); ++i)
+        {
+            const auto val = lowOri.RawMemory()[i];
+            const CheckElement check = (val == 0) ? 0 : ((val > 0) ? 1 : -1);
+            assert(lowRes.RawMemory()[i] == check);
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -117,5 +134,6 @@ namespace Test::Operators::Elwentwise
         test_sign_case1();
         test_sign_case2();
         test_sign_case3();
+        test_sign_case4();
     }
 }
\ No newline at end of file
@@ -108,6 +108,29 @@ namespace
         }
         cout << "done" << endl;
     }
+
+    void test_substract_case5()
+    {
+        cout << "Test substract case 5 (broadcast)\t";
+        auto bias = GenMatrix<CheckElement>(3, 8, -1, 0.3);
+        auto batch = GenBatchMatrix<CheckElement>(4, 3, 8, 2, -0.1);
+        auto res1 = Evaluate(batch - Duplicate(bias, batch.Shape()));
+        auto res2 = Evaluate(Duplicate(bias, batch.Shape()) - batch);
+        assert(res1.Shape() == batch.Shape());
+        for (size_t b = 0; b < 4; ++b)
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t k = 0; k < 8; ++k)
+                {
+                    auto check = batch[b](i, k) - bias(i, k);
+                    assert(fabs(check - res1[b](i, k)) < 0.001f);
+                    assert(fabs(check + res2[b](i, k)) < 0.001f);
+                }
+            }
+        }
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Elwentwise
@@ -118,5 +141,6 @@ namespace Test::Operators::Elwentwise
         test_substract_case2();
         test_substract_case3();
         test_substract_case4();
+        test_substract_case5();
     }
 }
\ No newline at end of file
@@ -109,6 +109,56 @@ namespace
         assert(fabs(check - res.Value()) < 0.001f);
         cout << "done" << endl;
     }
+    void test_nll_loss_case5()
+    {
+        cout << "Test NLL loss case 5 (softmax input, fused)\t";
+        auto weight = GenBatchMatrix<CheckElement>(3, 4, 300, 0, 0.0001f);
+        auto logits = GenBatchMatrix<CheckElement>(3, 4, 300, -20, 0.037f);
+        auto res = Evaluate(NLLLoss(weight, Softmax(logits)));
+
+        auto softmaxRes = Evaluate(Softmax(logits));
+        double check = 0;
+        for (size_t b = 0; b < 3; ++b)
+        {
+            for (size_t i = 0; i < 4; ++i)
+            {
+                for (size_t j = 0; j < 300; ++j)
+                {
+                    check -= weight[b](i, j) * log((double)softmaxRes[b](i, j));
+                }
+            }
+        }
+        check /= 3;
+        assert(fabs(check - res.Value()) < 0.0001 * fabs(check));
+
+        auto matrixRes = Evaluate(NLLLoss(weight[1], Softmax(logits[1])));
+        auto matrixCheck = Evaluate(NLLLoss(weight[1], softmaxRes[1]));
+        assert(fabs(matrixCheck.Value() - matrixRes.Value()) < 0.0001 * fabs(matrixCheck.Value()));
+        cout << "done" << endl;
+    }
+
+    void test_nll_loss_case6()
+    {
+        cout << "Test NLL loss case 6 (softmax input, one-hot target)\t";
+        auto logits = GenBatchMatrix<CheckElement>(4, 1, 1000, -3, 0.0071f);
+        BatchOneHotVector<CheckElement, CheckDevice> target(1000, std::vector<size_t>{3, 999, 0, 517});
+        auto res = Evaluate(NLLLoss(target, Softmax(logits)));
+
+        auto softmaxRes = Evaluate(Softmax(logits));
+        const size_t hotPos[] = {3, 999, 0, 517};
+        double check = 0;
+        for (size_t b = 0; b < 4; ++b)
+        {
+            check -= log((double)softmaxRes[b](0, hotPos[b]));
+        }
+        check /= 4;
+        assert(fabs(check - res.Value()) < 0.0001 * fabs(check));
+
+        OneHotVector<CheckElement, CheckDevice> single(1000, 517);
+        auto singleRes = Evaluate(NLLLoss(single, Softmax(logits[3])));
+        assert(fabs(-log((double)softmaxRes[3](0, 517)) - singleRes.Value()) < 0.0001);
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Operators::Loss
@@ -119,6 +169,8 @@ namespace Test::Operators::Loss
         test_nll_loss_case2();
         test_nll_loss_case3();
         test_nll_loss_case4();
+        test_nll_loss_case5();
+        test_nll_loss_case6();
     }
 }
 
@@ -1,6 +1,7 @@
 #include <MetaNN/meta_nn.h>
 #include <calculate_tags.h>
 #include <data_gen.h>
+#include <cmath>
 #include <iostream>
 using namespace std;
 using namespace MetaNN;
@@ -262,6 +263,55 @@ namespace
         layer.NeutralInvariant();
         cout << "done" << endl;
     }
+
+    // TParam is an inference-only storage converted from the principal parameter in the load buffer.
+    template <typename TParam>
+    void CheckConvertedParam(size_t rowNum, size_t colNum, float tolerance)
+    {
+        using RootLayer = MakeInferLayer<ParamSourceLayer, PParamTypeIs<TParam>>;
+        static_assert(!RootLayer::IsFeedbackOutput);
+        static_assert(!RootLayer::IsUpdate);
+        
+        auto filler = MakeInitializer<CheckElement>();
+        LoadBuffer<CheckElement, CheckDevice> loadBuffer;
+        
+        auto mat = GenMatrix<CheckElement>(rowNum, colNum, -1, 0.1f);
+        loadBuffer.Set("root", mat);
+
+        RootLayer layer("root", "root", rowNum, colNum);
+        layer.Init(filler, loadBuffer);
+        
+        auto fpRes = layer.FeedForward(LayerInputCont<RootLayer>());
+        auto w = fpRes.template Get<LayerOutput>();
+        static_assert(std::is_same_v<decltype(w), TParam>);
+        for (size_t i = 0; i < rowNum; ++i)
+        {
+            for (size_t j = 0; j < colNum; ++j)
+            {
+                assert(fabs(w(i, j) - mat(i, j)) <= tolerance);
+            }
+        }
+
+        RootLayer missing("missing", "missing", rowNum, colNum);
+        bool exceptionCatched = false;
+        try
+        {
+            missing.Init(filler, loadBuffer);
+        }
+        catch (std::runtime_error&)
+        {
+            exceptionCatched = true;
+        }
+        assert(exceptionCatched);
+    }
+
+    void test_param_source_layer9()
+    {
+        cout << "Test param source layer case 9 (converted parameters from load buffer)...\t";
+        CheckConvertedParam<QuantizedMatrix<CheckElement, CheckDevice>>(10, 3, 0.01f);
+        CheckConvertedParam<PackedMatrix<CheckElement, CheckDevice>>(10, 19, 0);
+        cout << "done" << endl;
+    }
 }
 
 namespace Test::Layer::Source
@@ -276,5 +326,6 @@ namespace Test::Layer::Source
         test_param_source_layer6();
         test_param_source_layer7();
         test_param_source_layer8();
+        test_param_source_layer9();
     }
 }
\ No newline at end of file
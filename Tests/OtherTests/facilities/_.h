@@ -0,0 +1,6 @@
+#pragma once
+
+namespace Test::Facilities
+{
+    void test_thread_pool();
+}
@@ -0,0 +1,79 @@
+#include <MetaNN/meta_nn.h>
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+using namespace MetaNN;
+using namespace std;
+
+namespace
+{
+    void test_thread_pool_case1()
+    {
+        cout << "Test thread pool case 1 (back-to-back jobs)...\t";
+        ThreadPool pool(4);
+        assert(pool.ThreadNum() == 5);
+
+        vector<atomic<size_t>> hits(64);
+        for (size_t job = 0; job < 5000; ++job)
+        {
+            const size_t taskNum = 2 + job % 63;
+            // yielding lets workers that woke up for a previous job interleave with this one.
+            pool.ParallelFor(taskNum, [&hits](size_t i)
+                             {
+                                 hits[i].fetch_add(1);
+                                 if (i % 8 == 0) this_thread::yield();
+                             });
+            for (size_t i = 0; i < taskNum; ++i)
+            {
+                assert(hits[i].exchange(0) == 1);
+            }
+            for (size_t i = taskNum; i < hits.size(); ++i)
+            {
+                assert(hits[i] == 0);
+            }
+        }
+        cout << "done" << endl;
+    }
+
+    void test_thread_pool_case2()
+    {
+        cout << "Test thread pool case 2 (exceptions)...\t";
+        ThreadPool pool(4);
+        for (size_t job = 0; job < 1000; ++job)
+        {
+            atomic<size_t> count{0};
+            bool caught = false;
+            try
+            {
+                pool.ParallelFor(16, [&count](size_t i)
+                                 {
+                                     count.fetch_add(1);
+                                     if (i == 7) throw std::runtime_error("task 7");
+                                 });
+            }
+            catch (std::runtime_error&)
+            {
+                caught = true;
+            }
+            assert(caught);
+            assert(count == 16);
+
+            size_t sum = 0;
+            pool.ParallelFor(8, [&sum](size_t i) { if (i == 0) sum = 1; });
+            assert(sum == 1);
+        }
+        cout << "done" << endl;
+    }
+}
+
+namespace Test::Facilities
+{
+    void test_thread_pool()
+    {
+        test_thread_pool_case1();
+        test_thread_pool_case2();
+    }
+}
@@ -1,8 +1,10 @@
+#include <facilities/_.h>
 #include <model/_.h>
 #include <policies/_.h>
 
 int main(int argc, char **argv)
 {
+    Test::Facilities::test_thread_pool();
     Test::test_model();
     Test::Policies::Test();
 }